@@ -0,0 +1,122 @@
+// Times the report's aggregates on a million items: the per-item passes over the
+// linked list (total pages, total hours, the two again for the average speed,
+// and one more for the per-difficulty sums) against one fused pass over
+// ReadingItemColumns. The list is sorted by title first, so neighbouring nodes
+// point at items scattered across the heap, as they are after a user sort.
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/safe_divide.h"
+#include "models/audio_book.h"
+#include "models/print_book.h"
+#include "structures/reading_item_columns.h"
+#include "structures/reading_item_list.h"
+
+static void fillRandom(ReadingItemList &list, ReadingItemColumns &columns, int itemCount, std::mt19937 &random)
+{
+    std::uniform_int_distribution<int> pages(20, 1500);
+    std::uniform_int_distribution<int> quarterHours(1, 200);
+    std::uniform_int_distribution<int> difficulty(EASY, HARD);
+    std::uniform_int_distribution<int> cents(0, 5000);
+
+    std::vector<ReadingItem *> batch;
+    for (int i = 0; i < itemCount; i++)
+    {
+        PriceInfo price(cents(random) / 100.0, false);
+        std::string title = "Title " + std::to_string(random() % (itemCount * 4));
+        Difficulty level = static_cast<Difficulty>(difficulty(random));
+        if (i % 3 == 0)
+        {
+            batch.push_back(new AudioBook(title, pages(random), quarterHours(random) / 4.0, level, "Narrator", price));
+        }
+        else
+        {
+            batch.push_back(new PrintBook(title, pages(random), quarterHours(random) / 4.0, level, "Author", price));
+        }
+    }
+
+    list.insertRange(batch);
+    list.sortByTitle();
+    columns.reserve(itemCount);
+    for (ReadingItem *item : list)
+    {
+        columns.insert(item);
+    }
+}
+
+template <typename Work>
+static double timeRuns(Work work)
+{
+    const int runs = 20;
+    auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < runs; run++)
+    {
+        work();
+    }
+
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count() / runs;
+}
+
+int main()
+{
+    const int itemCount = 1000000;
+    std::mt19937 random(2026);
+    ReadingItemList list;
+    ReadingItemColumns columns;
+    fillRandom(list, columns, itemCount, random);
+
+    double listSpeed = 0.0;
+    double listHardHours = 0.0;
+    const double listMs = timeRuns(
+        [&]()
+        {
+            int pages = 0;
+            double hours = 0.0;
+            for (const ReadingItem *item : list)
+            {
+                pages += item->getPages();
+            }
+
+            for (const ReadingItem *item : list)
+            {
+                hours += item->getHours();
+            }
+
+            // getAvgSpeed walked the list twice more.
+            int speedPages = 0;
+            double speedHours = 0.0;
+            for (const ReadingItem *item : list)
+            {
+                speedPages += item->getPages();
+            }
+
+            for (const ReadingItem *item : list)
+            {
+                speedHours += item->getHours();
+            }
+
+            listSpeed = safeDivide(static_cast<double>(speedPages), speedHours);
+            double hardHours = 0.0;
+            for (const ReadingItem *item : list)
+            {
+                hardHours += item->getDifficulty() == HARD ? item->getHours() : 0.0;
+            }
+
+            listHardHours = hardHours + (pages > 0 ? 0.0 : hours);
+        });
+
+    LibraryTotals totals;
+    const double columnMs = timeRuns([&]() { totals = columns.aggregate(); });
+
+    std::cout << itemCount << " items\n" << std::fixed << std::setprecision(2);
+    std::cout << std::setw(28) << std::left << "linked list, 5 passes" << std::right << std::setw(10) << listMs
+              << " ms  (speed " << listSpeed << ", hard hours " << listHardHours << ")\n";
+    std::cout << std::setw(28) << std::left << "columns, fused pass" << std::right << std::setw(10) << columnMs
+              << " ms  (speed " << totals.averageSpeed() << ", hard hours " << totals.hoursFor(HARD) << ")\n";
+    return 0;
+}
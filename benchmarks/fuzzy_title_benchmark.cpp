@@ -0,0 +1,68 @@
+// Times TitleBkTree "did you mean" lookups on 500,000 titles next to computing
+// the edit distance to every title. The tree only compares the query with
+// nodes whose edge distances could still lead to a match.
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "models/print_book.h"
+#include "structures/title_bk_tree.h"
+
+static double elapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    const int itemCount = 500000;
+    const std::vector<std::string> words = {"deep", "work", "atomic", "habits", "the", "art", "of", "war",
+                                            "learning", "river", "silent", "garden", "empire", "night", "code"};
+    std::mt19937 random(2026);
+    std::vector<std::unique_ptr<PrintBook>> books;
+    books.reserve(itemCount);
+    for (int i = 0; i < itemCount; i++)
+    {
+        std::string title = words[random() % words.size()] + " " + words[random() % words.size()] + " " +
+                            std::to_string(random() % 100000);
+        books.push_back(std::make_unique<PrintBook>(title, 100, 2.0, EASY, "Author", PriceInfo(1.0, false)));
+    }
+
+    TitleBkTree tree;
+    auto start = std::chrono::steady_clock::now();
+    for (const std::unique_ptr<PrintBook> &book : books)
+    {
+        tree.insert(book.get());
+    }
+
+    std::cout << itemCount << " items, tree built in " << std::fixed << std::setprecision(1) << elapsedMs(start)
+              << " ms\n";
+
+    for (int maxDistance = 1; maxDistance <= 2; maxDistance++)
+    {
+        for (const std::string query : {"silnet night 4242", "garden empir 77", "deep wrok 31337"})
+        {
+            start = std::chrono::steady_clock::now();
+            const std::size_t found = tree.findWithin(query, maxDistance).size();
+            const double treeMs = elapsedMs(start);
+
+            start = std::chrono::steady_clock::now();
+            std::size_t scanned = 0;
+            for (const std::unique_ptr<PrintBook> &book : books)
+            {
+                scanned += TitleBkTree::editDistance(query, book->getTitle(), maxDistance) <= maxDistance;
+            }
+
+            std::cout << "k=" << maxDistance << " " << std::setw(22) << std::left << ("\"" + query + "\"")
+                      << std::right << std::setw(6) << found << " hits  tree " << std::setw(8)
+                      << std::setprecision(3) << treeMs << " ms  scan " << std::setw(8) << elapsedMs(start)
+                      << " ms (" << scanned << ")\n";
+        }
+    }
+
+    return 0;
+}
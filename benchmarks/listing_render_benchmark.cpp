@@ -0,0 +1,105 @@
+// Renders a 500,000-item library three times the way the tracker lists it
+// (traverse, and the "Item n: name" + print lines of the report) into a
+// discarding stream, counting heap allocations with a replaced operator new.
+// The first pass fills each item's cached display name; later passes should
+// allocate nothing per item.
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#include "models/audio_book.h"
+#include "models/print_book.h"
+#include "structures/reading_item_list.h"
+
+static std::atomic<long long> allocationCount(0);
+
+void *operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size == 0 ? 1 : size))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+// Counts characters and discards them, so the timing is the rendering alone.
+class DiscardBuffer : public std::streambuf
+{
+public:
+    long long written = 0;
+
+protected:
+    int_type overflow(int_type character) override
+    {
+        written++;
+        return character;
+    }
+
+    std::streamsize xsputn(const char *, std::streamsize count) override
+    {
+        written += count;
+        return count;
+    }
+};
+
+int main()
+{
+    const int itemCount = 500000;
+
+    ReadingItemList list;
+    for (int i = 0; i < itemCount; i++)
+    {
+        const std::string title = "Library Title Number " + std::to_string(i);
+        if (i % 3 == 0)
+        {
+            list.insertBack(new AudioBook(title, 320, 9.5, MEDIUM, "Narrator " + std::to_string(i % 500), PriceInfo(0.0, true)));
+        }
+        else
+        {
+            list.insertBack(new PrintBook(title, 300, 6.0, EASY, "Author " + std::to_string(i % 3000), PriceInfo(12.99, false)));
+        }
+    }
+
+    DiscardBuffer buffer;
+    std::ostream output(&buffer);
+    std::cout << std::fixed << std::setprecision(1);
+    for (int pass = 1; pass <= 3; pass++)
+    {
+        const long long allocationsBefore = allocationCount.load();
+        auto start = std::chrono::steady_clock::now();
+
+        list.traverse(output);
+        int itemNumber = 1;
+        for (const ReadingItem *item : list)
+        {
+            output << "Item " << itemNumber++ << ": " << item->displayName() << "\n";
+            item->print(output);
+        }
+
+        auto finish = std::chrono::steady_clock::now();
+        std::cout << "pass " << pass << ": "
+                  << std::setw(8) << std::chrono::duration<double, std::milli>(finish - start).count() << " ms, "
+                  << std::setw(8) << (allocationCount.load() - allocationsBefore) << " allocations\n";
+    }
+
+    std::cout << "(" << buffer.written << " characters rendered)\n";
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Builds 500,000 print books whose authors come from 3,000 distinct names and
+// counts the heap bytes used by the books, and separately by one std::string
+// per book, which is what each book held before names were interned. It also
+// times PrintBook::operator== over neighbouring pairs, which now compares
+// author symbols before titles.
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/name_pool.h"
+#include "models/print_book.h"
+
+static std::size_t allocatedBytes = 0;
+
+void *operator new(std::size_t size)
+{
+    allocatedBytes += size;
+    if (void *memory = std::malloc(size))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+int main()
+{
+    const int itemCount = 500000;
+    const int authorCount = 3000;
+    std::mt19937 random(2026);
+
+    std::vector<std::string> authors;
+    for (int i = 0; i < authorCount; i++)
+    {
+        authors.push_back("Author Firstname Lastname " + std::to_string(i));
+    }
+
+    std::vector<int> picks;
+    for (int i = 0; i < itemCount; i++)
+    {
+        picks.push_back(static_cast<int>(random() % authorCount));
+    }
+
+    const std::size_t stringStart = allocatedBytes;
+    std::vector<std::string> perItemNames;
+    perItemNames.reserve(itemCount);
+    for (int pick : picks)
+    {
+        perItemNames.push_back(authors[pick]);
+    }
+    const std::size_t stringBytes = allocatedBytes - stringStart - itemCount * sizeof(std::string);
+
+    const std::size_t bookStart = allocatedBytes;
+    std::vector<PrintBook> books;
+    books.reserve(itemCount);
+    PriceInfo price(9.99, false);
+    for (int i = 0; i < itemCount; i++)
+    {
+        books.emplace_back("Title " + std::to_string(i % 1000), 300, 6.0, MEDIUM, authors[picks[i]], price);
+    }
+    const std::size_t bookBytes = allocatedBytes - bookStart;
+
+    auto start = std::chrono::steady_clock::now();
+    int equalPairs = 0;
+    for (int i = 1; i < itemCount; i++)
+    {
+        equalPairs += books[i] == books[i - 1];
+    }
+    auto finish = std::chrono::steady_clock::now();
+
+    std::cout << itemCount << " books, " << NamePool::global().size() << " pooled names ("
+              << NamePool::global().storedBytes() << " characters)\n";
+    std::cout << "sizeof(PrintBook): " << sizeof(PrintBook) << " bytes\n";
+    std::cout << "heap for books (titles, keys, pool): " << bookBytes / 1024 << " KiB\n";
+    std::cout << "heap one std::string per book would add: " << (stringBytes + itemCount * sizeof(std::string)) / 1024
+              << " KiB\n";
+    std::cout << "operator== over neighbours: " << std::fixed << std::setprecision(2)
+              << std::chrono::duration<double, std::milli>(finish - start).count() << " ms (" << equalPairs
+              << " equal)\n";
+    return 0;
+}
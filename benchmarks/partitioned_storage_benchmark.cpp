@@ -0,0 +1,114 @@
+// Compares a million mixed items in ReadingItemList (one heap object per item,
+// virtual calls) with the same items in PartitionedReadingItemStore (one dense
+// vector per concrete type). Times a type-specific query, "audiobooks included
+// with a subscription", and a per-item toStream pass. The list is sorted by
+// title first, so its item pointers jump around the heap.
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "structures/partitioned_reading_item_store.h"
+#include "structures/reading_item_list.h"
+
+template <typename Work>
+static double timeMs(Work work)
+{
+    auto start = std::chrono::steady_clock::now();
+    work();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+static void report(const char *label, double listMs, double storeMs)
+{
+    std::cout << std::setw(28) << std::left << label << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << listMs << " ms" << std::setw(10) << storeMs << " ms\n";
+}
+
+int main()
+{
+    const int itemCount = 1000000;
+    std::mt19937 random(2026);
+    std::uniform_int_distribution<int> pages(20, 1500);
+    std::uniform_int_distribution<int> quarterHours(1, 200);
+    std::uniform_int_distribution<int> difficulty(EASY, HARD);
+
+    ReadingItemList list;
+    std::vector<ReadingItem *> batch;
+    for (int i = 0; i < itemCount; i++)
+    {
+        PriceInfo price((random() % 5000) / 100.0, random() % 2 == 0);
+        std::string title = "Title " + std::to_string(random() % (itemCount * 4));
+        Difficulty level = static_cast<Difficulty>(difficulty(random));
+        if (i % 3 == 0)
+        {
+            batch.push_back(new AudioBook(title, pages(random), quarterHours(random) / 4.0, level, "Narrator", price));
+        }
+        else
+        {
+            batch.push_back(new PrintBook(title, pages(random), quarterHours(random) / 4.0, level, "Author", price));
+        }
+    }
+
+    list.insertRange(batch);
+    list.sortByTitle();
+
+    PartitionedReadingItemStore store;
+    for (const ReadingItem *item : list)
+    {
+        store.insertCopy(*item);
+    }
+
+    std::size_t listMatches = 0;
+    std::size_t storeMatches = 0;
+    const double listQueryMs = timeMs(
+        [&]()
+        {
+            for (const ReadingItem *item : list)
+            {
+                const AudioBook *book = dynamic_cast<const AudioBook *>(item);
+                listMatches += book != nullptr && book->getPrice().getIncludedWithSubscription();
+            }
+        });
+    const double storeQueryMs = timeMs(
+        [&]()
+        {
+            storeMatches = store.select<AudioBook>(
+                [](const AudioBook &book) { return book.getPrice().getIncludedWithSubscription(); }).size();
+        });
+
+    std::ostringstream listOut;
+    std::ostringstream storeOut;
+    const double listStreamMs = timeMs(
+        [&]()
+        {
+            for (const ReadingItem *item : list)
+            {
+                item->toStream(listOut);
+            }
+        });
+    const double storeStreamMs = timeMs(
+        [&]()
+        {
+            for (const PrintBook &book : store.itemsOf<PrintBook>())
+            {
+                book.toStream(storeOut);
+            }
+
+            for (const AudioBook &book : store.itemsOf<AudioBook>())
+            {
+                book.toStream(storeOut);
+            }
+        });
+
+    std::cout << itemCount << " items" << std::setw(29) << "list" << std::setw(13) << "by type\n";
+    report("subscription audiobooks", listQueryMs, storeQueryMs);
+    report("toStream", listStreamMs, storeStreamMs);
+    std::cout << (listMatches == storeMatches && listOut.str().size() == storeOut.str().size() ? "results match\n"
+                                                                                               : "results differ\n");
+    return 0;
+}
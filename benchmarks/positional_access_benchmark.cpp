@@ -0,0 +1,110 @@
+// Compares positional access on ReadingItemList (walks from the head), on
+// ReadingItemList with its position index (as the Manager keeps it), and on
+// ReadingItemSkipList (both expected O(log n)) for random at() lookups and for
+// removeAt/insertAt churn at random positions.
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "models/print_book.h"
+#include "structures/reading_item_list.h"
+#include "structures/reading_item_skip_list.h"
+
+static const int OPERATIONS = 2000;
+
+// Keeps the optimizer from discarding lookups whose results are otherwise unused.
+static volatile long long sink;
+
+template <typename List>
+static void fill(List &list, int itemCount)
+{
+    PriceInfo price(9.99, false);
+    for (int i = 0; i < itemCount; i++)
+    {
+        list.insertBack(new PrintBook("Title " + std::to_string(i), 100, 2.0, EASY, "Author", price));
+    }
+}
+
+template <typename List>
+static double timeLookups(const List &list, const std::vector<int> &indexes)
+{
+    long long checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int index : indexes)
+    {
+        checksum += list.at(index)->getPages();
+    }
+    auto finish = std::chrono::steady_clock::now();
+
+    sink = sink + checksum;
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+static double timeChurn(ReadingItemSkipList &list, const std::vector<int> &indexes)
+{
+    PriceInfo price(9.99, false);
+    auto start = std::chrono::steady_clock::now();
+    for (int index : indexes)
+    {
+        list.removeAt(index);
+        list.insertAt(index, new PrintBook("Churn " + std::to_string(index), 100, 2.0, EASY, "Author", price));
+    }
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+// ReadingItemList has no insertAt, so its churn removes at the position and appends.
+static double timeChurn(ReadingItemList &list, const std::vector<int> &indexes)
+{
+    PriceInfo price(9.99, false);
+    auto start = std::chrono::steady_clock::now();
+    for (int index : indexes)
+    {
+        list.removeAt(index);
+        list.insertBack(new PrintBook("Churn " + std::to_string(index), 100, 2.0, EASY, "Author", price));
+    }
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+int main()
+{
+    std::mt19937 random(2026);
+
+    std::cout << "Times in ms for " << OPERATIONS << " operations at random positions\n";
+    std::cout << std::setw(10) << "items" << std::setw(14) << "list at" << std::setw(14) << "indexed at"
+              << std::setw(14) << "skip at" << std::setw(16) << "list churn" << std::setw(16) << "indexed churn"
+              << std::setw(16) << "skip churn" << "\n";
+
+    for (int itemCount = 1000; itemCount <= 256000; itemCount *= 4)
+    {
+        std::uniform_int_distribution<int> position(0, itemCount - 1);
+        std::vector<int> indexes(OPERATIONS);
+        for (int &index : indexes)
+        {
+            index = position(random);
+        }
+
+        ReadingItemList list;
+        ReadingItemList indexedList;
+        indexedList.setPositionIndex(true);
+        ReadingItemSkipList skipList;
+        fill(list, itemCount);
+        fill(indexedList, itemCount);
+        fill(skipList, itemCount);
+
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::setw(10) << itemCount
+                  << std::setw(14) << timeLookups(list, indexes)
+                  << std::setw(14) << timeLookups(indexedList, indexes)
+                  << std::setw(14) << timeLookups(skipList, indexes)
+                  << std::setw(16) << timeChurn(list, indexes)
+                  << std::setw(16) << timeChurn(indexedList, indexes)
+                  << std::setw(16) << timeChurn(skipList, indexes) << "\n";
+    }
+
+    return 0;
+}
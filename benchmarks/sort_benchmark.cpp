@@ -0,0 +1,68 @@
+// Times ReadingItemList::sortByTitle on shuffled libraries of growing size.
+// The last column divides the time by n log2 n; it stays roughly flat when the
+// sort scales as O(n log n) and would grow linearly for a quadratic sort.
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "models/print_book.h"
+#include "structures/reading_item_list.h"
+
+static void fillShuffled(ReadingItemList &list, int itemCount, std::mt19937 &random)
+{
+    std::uniform_int_distribution<int> titleNumber(0, itemCount * 4);
+    PriceInfo price(9.99, false);
+
+    for (int i = 0; i < itemCount; i++)
+    {
+        std::string title = "Title " + std::to_string(titleNumber(random));
+        list.insertBack(new PrintBook(title, 100, 2.0, EASY, "Author", price));
+    }
+}
+
+static bool isSortedByTitle(const ReadingItemList &list)
+{
+    const ReadingItem *previous = nullptr;
+    for (ReadingItemListIterator it = list.begin(); it.isValid(); it.next())
+    {
+        if (previous != nullptr && it.getData()->getTitle() < previous->getTitle())
+        {
+            return false;
+        }
+
+        previous = it.getData();
+    }
+
+    return true;
+}
+
+int main()
+{
+    std::mt19937 random(2026);
+
+    std::cout << std::setw(10) << "items" << std::setw(14) << "sort ms"
+              << std::setw(22) << "ns / (n log2 n)" << "\n";
+
+    for (int itemCount = 1000; itemCount <= 1024000; itemCount *= 2)
+    {
+        ReadingItemList list;
+        fillShuffled(list, itemCount, random);
+
+        auto start = std::chrono::steady_clock::now();
+        list.sortByTitle();
+        auto finish = std::chrono::steady_clock::now();
+
+        double nanoseconds = std::chrono::duration<double, std::nano>(finish - start).count();
+        double perComparison = nanoseconds / (itemCount * std::log2(static_cast<double>(itemCount)));
+
+        std::cout << std::setw(10) << itemCount
+                  << std::setw(14) << std::fixed << std::setprecision(1) << nanoseconds / 1e6
+                  << std::setw(22) << std::setprecision(2) << perComparison
+                  << (isSortedByTitle(list) ? "" : "  NOT SORTED") << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+// Times title maintenance and lookups on ReadingItemList: 200,000 single
+// inserts (each one descends the sorted title index), then a million exact,
+// binary and prefix lookups with queries passed as string views. The lookups
+// fold the query into a reused buffer and compare it against arena-backed keys,
+// so none of them allocates.
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "models/print_book.h"
+#include "structures/reading_item_list.h"
+
+template <typename Work>
+static double timeMs(Work work)
+{
+    auto start = std::chrono::steady_clock::now();
+    work();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+int main()
+{
+    const int itemCount = 200000;
+    const int lookupCount = 1000000;
+    std::mt19937 random(2026);
+
+    std::vector<std::string> titles;
+    for (int i = 0; i < itemCount; i++)
+    {
+        titles.push_back("A Reasonably Long Library Title " + std::to_string(random() % (itemCount * 4)));
+    }
+
+    ReadingItemList list;
+    PriceInfo price(9.99, false);
+    const double insertMs = timeMs(
+        [&]()
+        {
+            for (const std::string &title : titles)
+            {
+                list.insertBack(new PrintBook(title, 300, 6.0, MEDIUM, "Author", price));
+            }
+        });
+
+    std::vector<std::string_view> queries;
+    for (int i = 0; i < lookupCount; i++)
+    {
+        queries.push_back(titles[random() % titles.size()]);
+    }
+
+    long long found = 0;
+    const double exactMs = timeMs(
+        [&]()
+        {
+            for (std::string_view query : queries)
+            {
+                found += list.searchByTitle(query) != nullptr;
+            }
+        });
+    const double binaryMs = timeMs(
+        [&]()
+        {
+            for (std::string_view query : queries)
+            {
+                found += list.binarySearchByTitle(query) >= 0;
+            }
+        });
+    const double prefixMs = timeMs(
+        [&]()
+        {
+            for (std::string_view query : queries)
+            {
+                found += static_cast<long long>(list.searchByTitlePrefix(query.substr(0, query.size() - 1)).size());
+            }
+        });
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << itemCount << " single inserts:        " << std::setw(9) << insertMs << " ms\n";
+    std::cout << lookupCount << " searchByTitle:        " << std::setw(9) << exactMs << " ms\n";
+    std::cout << lookupCount << " binarySearchByTitle:  " << std::setw(9) << binaryMs << " ms\n";
+    std::cout << lookupCount << " searchByTitlePrefix:  " << std::setw(9) << prefixMs << " ms\n";
+    std::cout << "(" << found << " hits)\n";
+    return 0;
+}
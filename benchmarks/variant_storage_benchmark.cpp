@@ -0,0 +1,111 @@
+// Compares a million heap-allocated items reached through ReadingItemList
+// pointers and virtual calls with the same items stored by value in a
+// VariantReadingItemList and reached through std::visit. Each layout is timed
+// for a numeric pass (pages and hours) and for formatting every item with
+// toStream into a discarded buffer. The list is sorted by title first, so its
+// item pointers jump around the heap as they do after a user sort.
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "structures/reading_item_list.h"
+#include "structures/variant_reading_item_list.h"
+
+template <typename Work>
+static double timeMs(Work work)
+{
+    auto start = std::chrono::steady_clock::now();
+    work();
+    auto finish = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+static void report(const char *label, double pointerMs, double variantMs)
+{
+    std::cout << std::setw(20) << std::left << label << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << pointerMs << " ms" << std::setw(10) << variantMs << " ms\n";
+}
+
+int main()
+{
+    const int itemCount = 1000000;
+    std::mt19937 random(2026);
+    std::uniform_int_distribution<int> pages(20, 1500);
+    std::uniform_int_distribution<int> quarterHours(1, 200);
+    std::uniform_int_distribution<int> difficulty(EASY, HARD);
+
+    ReadingItemList list;
+    std::vector<ReadingItem *> batch;
+    for (int i = 0; i < itemCount; i++)
+    {
+        PriceInfo price((random() % 5000) / 100.0, false);
+        std::string title = "Title " + std::to_string(random() % (itemCount * 4));
+        Difficulty level = static_cast<Difficulty>(difficulty(random));
+        if (i % 3 == 0)
+        {
+            batch.push_back(new AudioBook(title, pages(random), quarterHours(random) / 4.0, level, "Narrator", price));
+        }
+        else
+        {
+            batch.push_back(new PrintBook(title, pages(random), quarterHours(random) / 4.0, level, "Author", price));
+        }
+    }
+
+    list.insertRange(batch);
+    list.sortByTitle();
+
+    VariantReadingItemList values;
+    for (const ReadingItem *item : list)
+    {
+        values.insertCopy(*item);
+    }
+
+    double pointerHours = 0.0;
+    double variantHours = 0.0;
+    long long pointerPages = 0;
+    long long variantPages = 0;
+    const double pointerSumMs = timeMs(
+        [&]()
+        {
+            for (const ReadingItem *item : list)
+            {
+                pointerPages += item->getPages();
+                pointerHours += item->getHours();
+            }
+        });
+    const double variantSumMs = timeMs(
+        [&]()
+        {
+            values.visit(
+                [&](const auto &book)
+                {
+                    variantPages += book.getPages();
+                    variantHours += book.getHours();
+                });
+        });
+
+    std::ostringstream pointerOut;
+    std::ostringstream variantOut;
+    const double pointerStreamMs = timeMs(
+        [&]()
+        {
+            for (const ReadingItem *item : list)
+            {
+                item->toStream(pointerOut);
+            }
+        });
+    const double variantStreamMs = timeMs([&]() { values.visit([&](const auto &book) { book.toStream(variantOut); }); });
+
+    std::cout << itemCount << " items" << std::setw(21) << "pointers" << std::setw(13) << "variants\n";
+    report("pages + hours", pointerSumMs, variantSumMs);
+    report("toStream", pointerStreamMs, variantStreamMs);
+    std::cout << (pointerPages == variantPages && pointerHours == variantHours &&
+                          pointerOut.str().size() == variantOut.str().size()
+                      ? "results match\n"
+                      : "results differ\n");
+    return 0;
+}
@@ -1,17 +1,27 @@
 #pragma once
 
+#include <deque>
 #include <map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "common/difficulty.h"
 #include "common/safe_divide.h"
 #include "models/audio_book.h"
 #include "models/print_book.h"
+#include "structures/persistent_reading_item_list.h"
 #include "structures/queue.h"
+#include "structures/reading_item_columns.h"
 #include "structures/reading_item_list.h"
 #include "structures/stack.h"
+#include "structures/title_bk_tree.h"
+#include "structures/trigram_title_index.h"
 
-class Manager
+// Observes its items through the list, so a rename, field change or deletion
+// that bypasses the Manager API still reaches the title indexes and difficulty
+// counts.
+class Manager : private ReadingItemObserver
 {
 private:
     ReadingItemList items;
@@ -23,6 +33,42 @@ private:
     // lookup by key in O(log n) instead of scanning the whole linked list every time.
     std::map<Difficulty, int> difficultyCounts;
 
+    // Title trigrams -> items, kept in step with items so substring searches
+    // intersect a few posting lists instead of scanning every title.
+    TrigramTitleIndex titleTrigrams;
+
+    // Titles in a BK-tree, also kept in step with items, so "did you mean"
+    // suggestions compare the query against a small part of the library.
+    TitleBkTree titleTree;
+
+    // Pages, hours, difficulty and cost of every item in contiguous arrays, kept
+    // in step with items (the store observes each item's fields), so the report's
+    // totals and averages come from one streaming pass.
+    ReadingItemColumns columns;
+
+    // Library versions, oldest first, recorded only after enableHistory(). Each
+    // mutation appends one PersistentReadingItemList sharing all unchanged
+    // structure with the previous version; versions hold clones of the items,
+    // so they stay readable after the live items are removed. Edits to a live
+    // item replace its clone, so the newest version always matches the list.
+    std::deque<PersistentReadingItemList> versions;
+    int maxVersions = 0;
+
+    // Index of an item being renamed, read before the list may move it.
+    int renamedIndex = -1;
+
+    void titleChanging(ReadingItem &item, std::string_view newTitle) override;
+    void titleChanged(ReadingItem &item) override;
+    void fieldsChanging(ReadingItem &item) override;
+    void fieldsChanged(ReadingItem &item) override;
+    void itemDestroyed(ReadingItem &item) override;
+
+    void recordVersion(const PersistentReadingItemList &version);
+    std::vector<ReadingItem *> orderBeforeReorder() const;
+    void recordReorder(const std::vector<ReadingItem *> &before);
+    void forgetRemovedItems(const std::vector<ReadingItem *> &removed, const std::vector<int> &removedIndexes);
+    void sortLibraryUI();
+
     bool isNonEmpty(const std::string &value) const;
     std::string readLine(const std::string &prompt);
     int readPositiveInt(const std::string &prompt);
@@ -35,7 +81,7 @@ private:
     void removeItemUI();
 
 public:
-    Manager() = default;
+    Manager();
 
     bool isEmpty() const;
 
@@ -44,15 +90,64 @@ public:
     ReadingItem *operator[](int index) const;
 
     void addItem(ReadingItem *item);
+
+    /// Adds the batch through ReadingItemList::insertRange and updates the
+    /// difficulty map once per level instead of once per item.
+    void addItems(const std::vector<ReadingItem *> &batch);
     bool removeItem(int index);
 
+    /// Removes every item for which pred(const ReadingItem *) is true in one list
+    /// traversal, e.g. removeWhere([](const ReadingItem *item) { return item->getDifficulty() == HARD; }).
+    /// Removed titles are queued as one batch, each difficulty count is adjusted
+    /// once, and history records one version. Returns how many were removed.
+    template <typename Predicate>
+    int removeWhere(Predicate pred);
+
     int getItemCount() const;
     int getTotalPages() const;
     double getTotalHours() const;
 
-    int sequentialSearchByTitle(const std::string &title) const;
+    /// Totals, averages and per-difficulty sums from one pass over the columns.
+    LibraryTotals getTotals() const;
+
+    int sequentialSearchByTitle(std::string_view title) const;
     void sortByTitle();
-    int binarySearchByTitle(const std::string &title) const;
+
+    /// While enabled the library stays in title order: adds and imports land in
+    /// place, so binarySearchByTitle positions are list indexes and showReport
+    /// lists titles alphabetically without sorting. Enabling sorts once.
+    void setKeepSortedByTitle(bool enabled);
+    bool isKeptSortedByTitle() const;
+
+    /// Sorts the library by composed keys from sort_keys.h, most significant first,
+    /// e.g. sortBy<SortByDifficulty, Descending<SortByHours>>(). Stops keeping
+    /// title order.
+    template <typename... Keys>
+    void sortBy();
+    int binarySearchByTitle(std::string_view title) const;
+    std::vector<ReadingItem *> searchByTitlePrefix(std::string_view prefix) const;
+
+    /// Items whose title contains fragment, ignoring case, in title order.
+    /// Fragments of three or more characters use the trigram index; shorter ones
+    /// scan the list.
+    std::vector<ReadingItem *> searchByTitleFragment(const std::string &fragment) const;
+
+    /// Items whose title is within maxDistance edits of title, ignoring case,
+    /// closest first; used for "did you mean" after an exact search misses.
+    std::vector<ReadingItem *> suggestTitles(const std::string &title, int maxDistance = 2) const;
+
+    /// Starts recording versions from the current library (an O(n) clone, once);
+    /// only the newest maxVersions are kept. Calling it again keeps the history
+    /// and only changes the limit.
+    void enableHistory(int maxVersions = 256);
+    bool isHistoryEnabled() const;
+
+    /// Versions are numbered 0 (oldest kept) to getVersionCount() - 1 (current).
+    int getVersionCount() const;
+
+    /// O(1). Throws ContainerException for a version that is not kept.
+    const PersistentReadingItemList &getVersion(int version) const;
+    PersistentListDiff diffVersions(int olderVersion, int newerVersion) const;
 
     double getAvgSpeed() const;
     int countByDifficulty(Difficulty difficulty) const;
@@ -70,3 +165,35 @@ public:
     void saveToFile() const;
     void run();
 };
+
+template <typename... Keys>
+void Manager::sortBy()
+{
+    const std::vector<ReadingItem *> before = orderBeforeReorder();
+    items.sortBy<Keys...>();
+    recordReorder(before);
+}
+
+template <typename Predicate>
+int Manager::removeWhere(Predicate pred)
+{
+    // extractIf calls the predicate once per item in list order, so counting the
+    // calls gives each removed item's index for the history version.
+    std::vector<int> removedIndexes;
+    int index = 0;
+    std::vector<ReadingItem *> removed = items.extractIf(
+        [&pred, &removedIndexes, &index](ReadingItem *item)
+        {
+            const bool matches = pred(static_cast<const ReadingItem *>(item));
+            if (matches)
+            {
+                removedIndexes.push_back(index);
+            }
+
+            index++;
+            return matches;
+        });
+
+    forgetRemovedItems(removed, removedIndexes);
+    return static_cast<int>(removed.size());
+}
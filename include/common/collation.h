@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Case-folded form of a title, computed once when the title is set so that
+// sorting, binary search and the title indexes compare plain bytes instead of
+// folding on every comparison. ASCII letters fold with a single range check;
+// titles with bytes above 0x7F take a slower path that also folds the two-byte
+// UTF-8 capitals of Latin-1 (U+00C0 to U+00DE). The key also remembers the
+// length of a leading "a ", "an " or "the ", so library-style orderings can skip
+// it without a second key.
+class CollationKey
+{
+private:
+    std::string folded;
+    std::size_t articleLength;
+
+public:
+    CollationKey();
+    explicit CollationKey(const std::string &title);
+
+    const std::string &full() const;
+
+    /// The key without its leading article, e.g. "hobbit" for "The Hobbit".
+    std::string_view withoutArticle() const;
+};
+
+/// Folds a query the same way CollationKey folds titles.
+std::string foldTitle(std::string_view text);
+
+/// foldTitle into an existing buffer, so repeated lookups reuse its capacity.
+void foldTitleInto(std::string_view text, std::string &folded);
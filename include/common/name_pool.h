@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Process-wide pool of distinct names (authors and narrators). Each name is
+// stored once and identified by a 32-bit symbol, so an item keeps 4 bytes instead
+// of its own std::string, and two names are equal exactly when their symbols
+// are. Names are never removed, so a view stays valid for the rest of the
+// program. Interning takes a lock; reading a name does not, so concurrent list
+// readers can print items while another thread adds new names.
+class NamePool
+{
+public:
+    using Symbol = std::uint32_t;
+
+private:
+    static const int BLOCK_BITS = 12;
+    static const int BLOCK_SIZE = 1 << BLOCK_BITS;
+    static const int MAX_BLOCKS = 4096;
+
+    // Names live in fixed blocks that are never moved, so a published block
+    // pointer is all a reader needs.
+    std::atomic<std::string *> blocks[MAX_BLOCKS];
+    std::unordered_map<std::string_view, Symbol> symbols;
+    Symbol nameCount;
+    std::size_t nameBytes;
+    mutable std::mutex mutex;
+
+public:
+    NamePool();
+    NamePool(const NamePool &) = delete;
+    NamePool &operator=(const NamePool &) = delete;
+    ~NamePool();
+
+    /// The pool PrintBook and AudioBook use.
+    static NamePool &global();
+
+    /// Symbol of name, adding it on first use. Throws ContainerException once
+    /// the pool holds MAX_BLOCKS * BLOCK_SIZE names.
+    Symbol intern(std::string_view name);
+
+    /// The name behind a symbol returned by intern.
+    std::string_view view(Symbol symbol) const;
+
+    int size() const;
+
+    /// Characters stored across all distinct names.
+    std::size_t storedBytes() const;
+};
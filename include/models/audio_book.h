@@ -1,28 +1,37 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+
+#include "common/name_pool.h"
 
 #include "models/price_info.h"
 #include "models/reading_item.h"
 
-class AudioBook : public ReadingItem
+class AudioBook final : public ReadingItem
 {
 private:
-    std::string narrator;
+    NamePool::Symbol narrator;
     PriceInfo price;
 
 public:
     AudioBook();
     AudioBook(const std::string &title, int pages, double hours, Difficulty difficulty,
               const std::string &narrator, const PriceInfo &price);
+    AudioBook(const AudioBook &other) = default;
+
+    /// Copies every field, notifying the item's observers like the setters do.
+    AudioBook &operator=(const AudioBook &other);
 
     void setNarrator(const std::string &narrator);
-    std::string getNarrator() const;
+    /// A view into NamePool::global(), valid for the rest of the program.
+    std::string_view getNarrator() const;
 
     void setPrice(const PriceInfo &price);
-    const PriceInfo &getPrice() const;
+    const PriceInfo &getPrice() const override;
 
-    std::string displayName() const override;
+    ReadingItem *clone() const override;
+    void appendDisplayName(std::string &buffer) const override;
     void toStream(std::ostream &os) const override;
     void print(std::ostream &os = std::cout) const override;
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <iosfwd>
 #include <string>
 
 class PriceInfo
@@ -20,4 +21,7 @@ public:
 
     bool isFree() const;
     std::string formattedCost() const;
+    /// Writes formattedCost() to os without building a string or touching the
+    /// stream's precision and flags.
+    void writeCost(std::ostream &os) const;
 };
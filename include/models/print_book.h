@@ -1,30 +1,39 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+
+#include "common/name_pool.h"
 
 #include "models/price_info.h"
 #include "models/reading_item.h"
 
-class PrintBook : public ReadingItem
+class PrintBook final : public ReadingItem
 {
 private:
-    std::string author;
+    NamePool::Symbol author;
     PriceInfo price;
 
 public:
     PrintBook();
     PrintBook(const std::string &title, int pages, double hours, Difficulty difficulty,
               const std::string &author, const PriceInfo &price);
+    PrintBook(const PrintBook &other) = default;
+
+    /// Copies every field, notifying the item's observers like the setters do.
+    PrintBook &operator=(const PrintBook &other);
 
     void setAuthor(const std::string &author);
-    std::string getAuthor() const;
+    /// A view into NamePool::global(), valid for the rest of the program.
+    std::string_view getAuthor() const;
 
     void setPrice(const PriceInfo &price);
-    const PriceInfo &getPrice() const;
+    const PriceInfo &getPrice() const override;
 
     bool operator==(const PrintBook &other) const;
 
-    std::string displayName() const override;
+    ReadingItem *clone() const override;
+    void appendDisplayName(std::string &buffer) const override;
     void toStream(std::ostream &os) const override;
     void print(std::ostream &os = std::cout) const override;
 };
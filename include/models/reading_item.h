@@ -1,25 +1,63 @@
 #pragma once
 
+#include <atomic>
 #include <iostream>
 #include <string>
+#include <string_view>
 
+#include "common/collation.h"
 #include "common/difficulty.h"
+#include "models/price_info.h"
+#include "models/reading_item_observer.h"
 
 class ReadingItem
 {
+private:
+    CollationKey collationKey;
+    ReadingItemObserverHook observers[MIRROR_OBSERVER + 1];
+    mutable std::string displayNameCache;
+    mutable std::atomic<bool> displayNameCached;
+
+    void assignTitle(const std::string &title, const CollationKey &key);
+
 protected:
     std::string title;
     int pages;
     Difficulty difficulty;
     double hours;
 
+    /// Every setter of pages, hours, difficulty or price brackets its change with
+    /// these, so observers that mirror those fields can follow it.
+    void notifyFieldsChanging();
+    void notifyFieldsChanged();
+
+    /// Drops the cached display name; setters of any field it shows call it.
+    void invalidateDisplayName();
+
 public:
     ReadingItem();
     ReadingItem(const std::string &title, int pages, double hours, Difficulty difficulty);
+    /// The copy starts with no observers and an empty display name cache.
+    ReadingItem(const ReadingItem &other);
     virtual ~ReadingItem();
 
+    /// Copies the title and base fields through the same notifications as the
+    /// setters, so the containers and stores observing this item stay in step.
+    /// The item keeps its own observers; a refused title leaves it unchanged.
+    ReadingItem &operator=(const ReadingItem &other);
+
+    /// Tells the item's observers before and after the change; throws
+    /// ContainerException (leaving the title as it was) if the list holding the
+    /// item refuses the new title.
     void setTitle(const std::string &title);
-    std::string getTitle() const;
+    const std::string &getTitle() const;
+
+    /// The title as a view, for lookups and comparisons that never need an owning string.
+    std::string_view titleView() const;
+
+    /// Folded title, refreshed by the constructors and setTitle; title order and
+    /// title lookups compare this instead of getTitle().
+    const CollationKey &getCollationKey() const;
 
     void setPages(int pages);
     int getPages() const;
@@ -30,7 +68,34 @@ public:
     void setDifficulty(Difficulty difficulty);
     Difficulty getDifficulty() const;
 
-    virtual std::string displayName() const = 0;
+    virtual const PriceInfo &getPrice() const = 0;
+
+    /// For containers and indexes: from now on observer hears about every change
+    /// to the item until it detaches. slot is the observer's own per-item number.
+    /// Throws ContainerException if another observer already holds the role.
+    void attachObserver(ObserverRole role, ReadingItemObserver *observer, int slot = -1);
+    void detachObserver(ObserverRole role);
+    ReadingItemObserver *getObserver(ObserverRole role) const;
+    int getObserverSlot(ObserverRole role) const;
+    void setObserverSlot(ObserverRole role, int slot);
+
+    /// Heap copy of the full item (with its derived type), unlinked from any list.
+    virtual ReadingItem *clone() const = 0;
+
+    /// Appends the display name (e.g. "Dune by Frank Herbert") to buffer, so a
+    /// caller that reuses one buffer renders many items without allocating.
+    virtual void appendDisplayName(std::string &buffer) const = 0;
+
+    /// The display name, built with appendDisplayName on first use and cached
+    /// until setTitle or a derived setter changes it. Concurrent readers may call
+    /// it: the first call fills the cache under a lock, later calls only read it.
+    const std::string &displayName() const;
+
+    /// Writes the display name to os through one reused thread-local buffer,
+    /// without filling the cache. Listings that print each name once use this;
+    /// callers that keep the string use displayName.
+    void writeDisplayName(std::ostream &os) const;
+
     virtual void toStream(std::ostream &os) const;
     virtual void print(std::ostream &os = std::cout) const;
 
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string_view>
+
+class ReadingItem;
+
+// Told about every change to the ReadingItems attached to it, so a container or
+// index that keeps a copy of an item's fields (a title key, a column row) can
+// update that copy in place instead of going stale. The models layer knows only
+// this interface; the structures that implement it attach themselves.
+class ReadingItemObserver
+{
+public:
+    /// The title is about to become newTitle; the item still has its old title
+    /// and collation key. A container may refuse the new title by throwing
+    /// ContainerException, which leaves the item unchanged.
+    virtual void titleChanging(ReadingItem &item, std::string_view newTitle) = 0;
+    virtual void titleChanged(ReadingItem &item) = 0;
+
+    /// Pages, hours, difficulty or price are about to change; the item still
+    /// has its old values, so an observer keyed on one of them can drop it here.
+    virtual void fieldsChanging(ReadingItem &item) = 0;
+    virtual void fieldsChanged(ReadingItem &item) = 0;
+
+    /// Called from the item's destructor while it is still attached.
+    virtual void itemDestroyed(ReadingItem &item) = 0;
+
+protected:
+    ~ReadingItemObserver() = default;
+};
+
+// The two ways an item can be observed: by the one container that holds it and
+// by one store that mirrors its fields. Each role has its own hook in the item.
+enum ObserverRole
+{
+    CONTAINER_OBSERVER,
+    MIRROR_OBSERVER
+};
+
+// Attachment slot embedded in each ReadingItem, one per role. slot is the
+// observer's own per-item number (a row or link index). Copies start detached:
+// copying an item never copies what observes it.
+struct ReadingItemObserverHook
+{
+    ReadingItemObserver *observer = nullptr;
+    int slot = -1;
+
+    ReadingItemObserverHook() = default;
+    ReadingItemObserverHook(const ReadingItemObserverHook &) {}
+    ReadingItemObserverHook &operator=(const ReadingItemObserverHook &) { return *this; }
+};
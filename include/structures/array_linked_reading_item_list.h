@@ -0,0 +1,90 @@
+#pragma once
+
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+#include "common/container_exception.h"
+#include "models/reading_item.h"
+
+class ArrayLinkedReadingItemList;
+
+class ArrayLinkedReadingItemListIterator
+{
+private:
+    const ArrayLinkedReadingItemList *list;
+    int slot;
+
+public:
+    explicit ArrayLinkedReadingItemListIterator(const ArrayLinkedReadingItemList *list = nullptr, int slot = -1);
+
+    bool isValid() const;
+    void next();
+    ReadingItem *getData() const;
+};
+
+// Doubly linked list with the same API as ReadingItemList whose links live in
+// one dense array owned by the list instead of in separately allocated nodes.
+// Each item records its slot in that array in its container observer hook, so
+// remove(item) finds its links in O(1) without a lookup, and removed slots are
+// reused through a free list. The links are not kept inside ReadingItem; only
+// the slot number is. An item can be in at most one list at a time, and
+// inserting one that already is, even into this list, throws.
+// Owns its items like ReadingItemList does.
+class ArrayLinkedReadingItemList : private ReadingItemObserver
+{
+private:
+    // next and prev are slots in links, -1 at either end; a free slot's next
+    // chains the free list.
+    struct Link
+    {
+        ReadingItem *item;
+        int next;
+        int prev;
+    };
+
+    std::vector<Link> links;
+    int head;
+    int tail;
+    int firstFree;
+    int count;
+
+    int acquireSlot(ReadingItem *item);
+    int slotAt(int index) const;
+    void unlink(int slot);
+
+    void titleChanging(ReadingItem &item, std::string_view newTitle) override;
+    void titleChanged(ReadingItem &item) override;
+    void fieldsChanging(ReadingItem &item) override;
+    void fieldsChanged(ReadingItem &item) override;
+    void itemDestroyed(ReadingItem &item) override;
+
+    friend class ArrayLinkedReadingItemListIterator;
+
+public:
+    ArrayLinkedReadingItemList();
+    ArrayLinkedReadingItemList(const ArrayLinkedReadingItemList &) = delete;
+    ArrayLinkedReadingItemList &operator=(const ArrayLinkedReadingItemList &) = delete;
+    ~ArrayLinkedReadingItemList();
+
+    bool isEmpty() const;
+    int size() const;
+    bool contains(const ReadingItem *item) const;
+
+    ArrayLinkedReadingItemListIterator begin() const;
+
+    /// Throws ContainerException for a null item or one already in a list,
+    /// including this one.
+    void insertFront(ReadingItem *item);
+    void insertBack(ReadingItem *item);
+    bool removeAt(int index);
+
+    /// Unlinks and deletes an item of this list in O(1); false if it is not a member.
+    bool remove(ReadingItem *item);
+    bool deleteByTitle(std::string_view title);
+    ReadingItem *searchByTitle(std::string_view title) const;
+    int findByTitle(std::string_view title) const;
+    ReadingItem *at(int index) const;
+    void traverse(std::ostream &os = std::cout) const;
+    void clear();
+};
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "common/container_exception.h"
+#include "models/reading_item.h"
+
+class ConcurrentReadingItemList;
+
+struct ConcurrentReadingItemNode
+{
+    ReadingItem *data;
+    std::atomic<ConcurrentReadingItemNode *> next;
+
+    explicit ConcurrentReadingItemNode(ReadingItem *data, ConcurrentReadingItemNode *next = nullptr);
+};
+
+class ConcurrentReadingItemListIterator
+{
+private:
+    ConcurrentReadingItemNode *current;
+
+public:
+    explicit ConcurrentReadingItemListIterator(ConcurrentReadingItemNode *start = nullptr);
+
+    bool isValid() const;
+    void next();
+    ReadingItem *getData() const;
+
+    ReadingItem *operator*() const;
+    ConcurrentReadingItemListIterator &operator++();
+    bool operator==(const ConcurrentReadingItemListIterator &other) const;
+    bool operator!=(const ConcurrentReadingItemListIterator &other) const;
+};
+
+// Read-side critical section over a ConcurrentReadingItemList. While a snapshot is
+// alive, no node or item it can reach is reclaimed, so it can be iterated from any
+// thread while writers insert and remove. It sees every item that stays in the list
+// for its whole lifetime exactly once, in list order; items inserted or removed
+// meanwhile may or may not appear. Taking one costs a few atomic operations.
+class ConcurrentReadingItemListSnapshot
+{
+private:
+    const ConcurrentReadingItemList &list;
+    std::atomic<std::uint64_t> &slot;
+
+public:
+    /// Throws ContainerException if every reader slot is already in use.
+    explicit ConcurrentReadingItemListSnapshot(const ConcurrentReadingItemList &list);
+    ConcurrentReadingItemListSnapshot(const ConcurrentReadingItemListSnapshot &) = delete;
+    ConcurrentReadingItemListSnapshot &operator=(const ConcurrentReadingItemListSnapshot &) = delete;
+    ~ConcurrentReadingItemListSnapshot();
+
+    ConcurrentReadingItemListIterator begin() const;
+    ConcurrentReadingItemListIterator end() const;
+    void traverse(std::ostream &os = std::cout) const;
+};
+
+// Singly linked list of ReadingItem* with read-copy-update style concurrency:
+// any number of threads read through snapshots without locking, while writers
+// (serialized by a mutex) publish link changes with atomic stores. A removed
+// node and its item are retired with the current epoch and deleted only once
+// every snapshot pinned at that epoch or earlier has been destroyed.
+// Owns its items like ReadingItemList does.
+class ConcurrentReadingItemList
+{
+private:
+    struct RetiredNode
+    {
+        ConcurrentReadingItemNode *node;
+        std::uint64_t epoch;
+    };
+
+    static const int MAX_READERS = 64;
+
+    std::atomic<ConcurrentReadingItemNode *> head;
+    ConcurrentReadingItemNode *tail;
+    std::atomic<int> count;
+
+    // Writers only.
+    mutable std::mutex writeMutex;
+    std::vector<RetiredNode> retired;
+
+    // Epoch 0 marks a free reader slot, so the global epoch starts at 1.
+    mutable std::atomic<std::uint64_t> globalEpoch;
+    mutable std::atomic<std::uint64_t> readerEpochs[MAX_READERS];
+
+    std::atomic<std::uint64_t> &pinReader() const;
+    void unlinkAfter(ConcurrentReadingItemNode *previous, ConcurrentReadingItemNode *node);
+    int reclaimRetired();
+
+    friend class ConcurrentReadingItemListSnapshot;
+
+public:
+    ConcurrentReadingItemList();
+    ConcurrentReadingItemList(const ConcurrentReadingItemList &) = delete;
+    ConcurrentReadingItemList &operator=(const ConcurrentReadingItemList &) = delete;
+
+    /// No snapshot of the list may outlive it.
+    ~ConcurrentReadingItemList();
+
+    bool isEmpty() const;
+    int size() const;
+
+    /// Throws ContainerException for a null item.
+    void insertFront(ReadingItem *item);
+    void insertBack(ReadingItem *item);
+    bool removeAt(int index);
+    bool remove(ReadingItem *item);
+    bool deleteByTitle(std::string_view title);
+    void clear();
+
+    /// Deletes retired nodes that no live snapshot can still reach and returns how
+    /// many were freed. Writers already do this after every removal.
+    int reclaim();
+
+    /// Removed nodes still waiting for older snapshots to finish.
+    int getRetiredCount() const;
+};
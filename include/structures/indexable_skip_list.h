@@ -0,0 +1,356 @@
+#pragma once
+
+#include <new>
+#include <random>
+
+#include "common/container_exception.h"
+
+// Node of an indexable skip list. links[i].span counts how many level-0 steps
+// the level-i link jumps over, which is what lets positional lookups skip ahead.
+// A null link's span is the distance to the last node, so a node can also find
+// its own rank by walking forward. The links are allocated together with the
+// node (see create), so following a link touches one block of memory.
+template <typename T>
+struct IndexableSkipListNode
+{
+    struct Link
+    {
+        IndexableSkipListNode *next;
+        int span;
+    };
+
+    T data;
+    int level;
+    Link *links;
+
+    static IndexableSkipListNode *create(T data, int level)
+    {
+        void *memory = ::operator new(sizeof(IndexableSkipListNode) + sizeof(Link) * level);
+        Link *links = reinterpret_cast<Link *>(static_cast<char *>(memory) + sizeof(IndexableSkipListNode));
+        for (int i = 0; i < level; i++)
+        {
+            new (&links[i]) Link{nullptr, 0};
+        }
+
+        return new (memory) IndexableSkipListNode(data, level, links);
+    }
+
+    static void destroy(IndexableSkipListNode *node)
+    {
+        node->~IndexableSkipListNode();
+        ::operator delete(node);
+    }
+
+    IndexableSkipListNode(const IndexableSkipListNode &) = delete;
+    IndexableSkipListNode &operator=(const IndexableSkipListNode &) = delete;
+
+private:
+    IndexableSkipListNode(T data, int level, Link *links)
+        : data(data), level(level), links(links) {}
+};
+
+// Sequence of values with expected O(log n) access, insertion and removal by
+// position, and O(log n) rank lookup from a node. Values are copied in and
+// never destroyed by the list, so a T that points at something leaves
+// ownership with the caller.
+template <typename T>
+class IndexableSkipList
+{
+public:
+    using Node = IndexableSkipListNode<T>;
+
+private:
+    static const int MAX_LEVEL = 32;
+
+    Node *header;
+    int level;
+    int count;
+    std::mt19937 random;
+
+    // Links a new node after update[i] on every level it gets; rank[i] is the
+    // 1-based position of update[i] (the header has rank 0).
+    Node *linkNew(Node **update, int *rank, T value)
+    {
+        int newLevel = randomLevel();
+        if (newLevel > level)
+        {
+            for (int i = level; i < newLevel; i++)
+            {
+                update[i] = header;
+                rank[i] = 0;
+                header->links[i].span = count;
+            }
+
+            level = newLevel;
+        }
+
+        Node *newNode = Node::create(value, newLevel);
+        for (int i = 0; i < newLevel; i++)
+        {
+            newNode->links[i].next = update[i]->links[i].next;
+            update[i]->links[i].next = newNode;
+            newNode->links[i].span = update[i]->links[i].span - (rank[0] - rank[i]);
+            update[i]->links[i].span = (rank[0] - rank[i]) + 1;
+        }
+
+        for (int i = newLevel; i < level; i++)
+        {
+            update[i]->links[i].span++;
+        }
+
+        count++;
+        return newNode;
+    }
+
+    int randomLevel()
+    {
+        // Each extra level is kept with probability 1/2.
+        int newLevel = 1;
+        while (newLevel < MAX_LEVEL && (random() & 1u) != 0)
+        {
+            newLevel++;
+        }
+
+        return newLevel;
+    }
+
+public:
+    IndexableSkipList()
+        : header(Node::create(T(), MAX_LEVEL)), level(1), count(0), random(2026) {}
+
+    IndexableSkipList(const IndexableSkipList &) = delete;
+    IndexableSkipList &operator=(const IndexableSkipList &) = delete;
+
+    ~IndexableSkipList()
+    {
+        clear();
+        Node::destroy(header);
+    }
+
+    int size() const
+    {
+        return count;
+    }
+
+    Node *first() const
+    {
+        return header->links[0].next;
+    }
+
+    /// Inserts so the value ends up at index (0 <= index <= size()) and returns
+    /// its node, which stays valid until the value is removed.
+    Node *insertAt(int index, T value)
+    {
+        if (index < 0 || index > count)
+        {
+            throw ContainerException("Index out of range.");
+        }
+
+        // update[i] is the last node on level i before the insertion point and
+        // rank[i] its 1-based position (the header has rank 0).
+        Node *update[MAX_LEVEL] = {};
+        int rank[MAX_LEVEL];
+        Node *current = header;
+        int traversed = 0;
+
+        for (int i = level - 1; i >= 0; i--)
+        {
+            while (current->links[i].next != nullptr && traversed + current->links[i].span <= index)
+            {
+                traversed += current->links[i].span;
+                current = current->links[i].next;
+            }
+
+            update[i] = current;
+            rank[i] = traversed;
+        }
+
+        return linkNew(update, rank, value);
+    }
+
+    /// Sorted insert for a list ordered so that isBefore(value) holds on a
+    /// leading run (see lastWhere): puts value right after that run, in the same
+    /// single descent, and returns the node before it (nullptr if value is now
+    /// first).
+    template <typename Predicate>
+    Node *insertAfterLastWhere(Predicate isBefore, T value)
+    {
+        Node *update[MAX_LEVEL] = {};
+        int rank[MAX_LEVEL];
+        Node *current = header;
+        int traversed = 0;
+
+        // A node that failed isBefore on one level is often the next node on the
+        // level below too; remembering it saves comparing it again.
+        const Node *rejected = nullptr;
+        for (int i = level - 1; i >= 0; i--)
+        {
+            while (current->links[i].next != nullptr && current->links[i].next != rejected &&
+                   isBefore(current->links[i].next->data))
+            {
+                traversed += current->links[i].span;
+                current = current->links[i].next;
+            }
+
+            rejected = current->links[i].next;
+
+            update[i] = current;
+            rank[i] = traversed;
+        }
+
+        linkNew(update, rank, value);
+        return current == header ? nullptr : current;
+    }
+
+    Node *pushBack(T value)
+    {
+        return insertAt(count, value);
+    }
+
+    /// Removes the node at index and returns its value. Throws ContainerException
+    /// for an index out of range.
+    T removeAt(int index)
+    {
+        if (index < 0 || index >= count)
+        {
+            throw ContainerException("Index out of range.");
+        }
+
+        Node *update[MAX_LEVEL] = {};
+        Node *current = header;
+        int traversed = 0;
+
+        for (int i = level - 1; i >= 0; i--)
+        {
+            while (current->links[i].next != nullptr && traversed + current->links[i].span <= index)
+            {
+                traversed += current->links[i].span;
+                current = current->links[i].next;
+            }
+
+            update[i] = current;
+        }
+
+        Node *nodeToDelete = update[0]->links[0].next;
+        for (int i = 0; i < level; i++)
+        {
+            if (update[i]->links[i].next == nodeToDelete)
+            {
+                update[i]->links[i].span += nodeToDelete->links[i].span - 1;
+                update[i]->links[i].next = nodeToDelete->links[i].next;
+            }
+            else
+            {
+                update[i]->links[i].span--;
+            }
+        }
+
+        while (level > 1 && header->links[level - 1].next == nullptr)
+        {
+            level--;
+        }
+
+        T value = nodeToDelete->data;
+        Node::destroy(nodeToDelete);
+        count--;
+        return value;
+    }
+
+    /// Removes a node of this list: its rank, then a positional removal.
+    T erase(const Node *node)
+    {
+        return removeAt(rankOf(node));
+    }
+
+    /// Node at index, or nullptr if index is out of range.
+    Node *nodeAt(int index) const
+    {
+        if (index < 0 || index >= count)
+        {
+            return nullptr;
+        }
+
+        // Ranks are 1-based, so the node at index sits at rank index + 1.
+        Node *current = header;
+        int traversed = 0;
+        for (int i = level - 1; i >= 0; i--)
+        {
+            while (current->links[i].next != nullptr && traversed + current->links[i].span <= index + 1)
+            {
+                traversed += current->links[i].span;
+                current = current->links[i].next;
+            }
+
+            if (traversed == index + 1)
+            {
+                return current;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// For a list ordered so that isBefore(value) holds on a leading run of it
+    /// (e.g. "key < x" on keys in ascending order): the last node of that run,
+    /// or nullptr if the run is empty, with the run's length in length. One
+    /// descent, expected O(log n).
+    template <typename Predicate>
+    Node *lastWhere(Predicate isBefore, int &length) const
+    {
+        Node *current = header;
+        int traversed = 0;
+        // A node that failed isBefore on one level is often the next node on the
+        // level below too; remembering it saves comparing it again.
+        const Node *rejected = nullptr;
+        for (int i = level - 1; i >= 0; i--)
+        {
+            while (current->links[i].next != nullptr && current->links[i].next != rejected &&
+                   isBefore(current->links[i].next->data))
+            {
+                traversed += current->links[i].span;
+                current = current->links[i].next;
+            }
+
+            rejected = current->links[i].next;
+        }
+
+        length = traversed;
+        return current == header ? nullptr : current;
+    }
+
+    /// 0-based index of a node of this list. Follows each node's highest link
+    /// to the end, summing spans; the levels met only rise, so this is the
+    /// reverse of a search and also expected O(log n).
+    int rankOf(const Node *node) const
+    {
+        int distanceToLast = 0;
+        for (const Node *current = node; current != nullptr;)
+        {
+            const typename Node::Link &top = current->links[current->level - 1];
+            distanceToLast += top.span;
+            current = top.next;
+        }
+
+        return count - 1 - distanceToLast;
+    }
+
+    void clear()
+    {
+        Node *current = header->links[0].next;
+        while (current != nullptr)
+        {
+            Node *next = current->links[0].next;
+            Node::destroy(current);
+            current = next;
+        }
+
+        for (int i = 0; i < MAX_LEVEL; i++)
+        {
+            header->links[i].next = nullptr;
+            header->links[i].span = 0;
+        }
+
+        level = 1;
+        count = 0;
+    }
+};
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <new>
+#include <utility>
+#include <vector>
+
+// Allocation counters reported by NodePool, mainly for tests and diagnostics.
+struct NodePoolStats
+{
+    int chunkAllocations;
+    int liveNodes;
+    int recycledNodes;
+};
+
+// Slab allocator for fixed-size list nodes. Nodes are carved from contiguous
+// chunks (8, 16, 32, ... up to 1024 nodes) instead of one heap allocation each;
+// released nodes go on a free list and are handed out again first.
+// releaseAll() drops every chunk at once, so a container can tear down all its
+// nodes without touching them individually.
+template <typename T>
+class NodePool
+{
+private:
+    static const int FIRST_CHUNK_SIZE = 8;
+    static const int MAX_CHUNK_SIZE = 1024;
+
+    union Slot
+    {
+        Slot *nextFree;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    std::vector<Slot *> chunks;
+    Slot *freeList;
+    Slot *bumpNext;
+    Slot *bumpEnd;
+    int nextChunkSize;
+    int chunkAllocations;
+    int liveNodes;
+    int recycledNodes;
+
+    void recycle(Slot *slot)
+    {
+        slot->nextFree = freeList;
+        freeList = slot;
+        recycledNodes++;
+    }
+
+    // Moves the unused tail of the current chunk onto the free list.
+    void retireBumpRange()
+    {
+        while (bumpNext != bumpEnd)
+        {
+            recycle(bumpNext++);
+        }
+    }
+
+    Slot *takeSlot()
+    {
+        if (freeList != nullptr)
+        {
+            Slot *slot = freeList;
+            freeList = slot->nextFree;
+            recycledNodes--;
+            return slot;
+        }
+
+        if (bumpNext == bumpEnd)
+        {
+            Slot *chunk = new Slot[nextChunkSize];
+            chunks.push_back(chunk);
+            bumpNext = chunk;
+            bumpEnd = chunk + nextChunkSize;
+            chunkAllocations++;
+            if (nextChunkSize < MAX_CHUNK_SIZE)
+            {
+                nextChunkSize *= 2;
+            }
+        }
+
+        return bumpNext++;
+    }
+
+public:
+    NodePool()
+        : freeList(nullptr), bumpNext(nullptr), bumpEnd(nullptr), nextChunkSize(FIRST_CHUNK_SIZE),
+          chunkAllocations(0), liveNodes(0), recycledNodes(0) {}
+
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    ~NodePool()
+    {
+        releaseAll();
+    }
+
+    template <typename... Args>
+    T *acquire(Args &&...args)
+    {
+        Slot *slot = takeSlot();
+        T *node;
+        try
+        {
+            node = new (slot->storage) T{std::forward<Args>(args)...};
+        }
+        catch (...)
+        {
+            recycle(slot);
+            throw;
+        }
+
+        liveNodes++;
+        return node;
+    }
+
+    /// Destroys the node and puts its slot on the free list for reuse.
+    void release(T *node)
+    {
+        node->~T();
+        recycle(reinterpret_cast<Slot *>(node));
+        liveNodes--;
+    }
+
+    /// Makes sure the next count acquisitions need at most this one chunk
+    /// allocation: recycled slots are used first, the rest come from a single
+    /// contiguous chunk.
+    void reserve(int count)
+    {
+        if (count <= recycledNodes + static_cast<int>(bumpEnd - bumpNext))
+        {
+            return;
+        }
+
+        retireBumpRange();
+        int chunkSize = count - recycledNodes;
+        Slot *chunk = new Slot[chunkSize];
+        chunks.push_back(chunk);
+        bumpNext = chunk;
+        bumpEnd = chunk + chunkSize;
+        chunkAllocations++;
+    }
+
+    /// Takes over every chunk of other, including the nodes still live in it, so
+    /// a container can relink another container's nodes without copying them.
+    /// other is left empty.
+    void adopt(NodePool &other)
+    {
+        if (&other == this)
+        {
+            return;
+        }
+
+        other.retireBumpRange();
+        while (other.freeList != nullptr)
+        {
+            Slot *slot = other.freeList;
+            other.freeList = slot->nextFree;
+            recycle(slot);
+        }
+
+        chunks.insert(chunks.end(), other.chunks.begin(), other.chunks.end());
+        liveNodes += other.liveNodes;
+
+        other.chunks.clear();
+        other.bumpNext = nullptr;
+        other.bumpEnd = nullptr;
+        other.nextChunkSize = FIRST_CHUNK_SIZE;
+        other.liveNodes = 0;
+        other.recycledNodes = 0;
+    }
+
+    /// Runs the node's destructor without recycling its slot. Use it on
+    /// nodes that are not trivially destructible before releaseAll().
+    void destroy(T *node)
+    {
+        node->~T();
+        liveNodes--;
+    }
+
+    /// Frees every chunk in one pass. Nodes still in use must already be
+    /// destroyed (or trivially destructible) and are invalid afterwards.
+    void releaseAll()
+    {
+        for (Slot *chunk : chunks)
+        {
+            delete[] chunk;
+        }
+
+        chunks.clear();
+        freeList = nullptr;
+        bumpNext = nullptr;
+        bumpEnd = nullptr;
+        nextChunkSize = FIRST_CHUNK_SIZE;
+        liveNodes = 0;
+        recycledNodes = 0;
+    }
+
+    NodePoolStats getStats() const
+    {
+        return NodePoolStats{chunkAllocations, liveNodes, recycledNodes};
+    }
+};
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/container_exception.h"
+#include "models/audio_book.h"
+#include "models/print_book.h"
+
+// Items stored by value and partitioned by concrete type: every PrintBook in one
+// contiguous vector and every AudioBook in another. A query about one type
+// ("audiobooks included with a subscription") scans only that type's dense
+// array, and a per-type loop calls print/toStream on a final class, so the
+// calls bind statically and can be inlined.
+// Each item also gets a sequence number when it is inserted; both partitions
+// stay sorted by it, so the mixed list order is a merge of the two and a global
+// index resolves by binary search. Removals shift values within one partition.
+// Pointers into a partition stay valid until the next insertion into or
+// removal from that partition.
+class PartitionedReadingItemStore
+{
+private:
+    template <typename Book>
+    struct Partition
+    {
+        std::vector<Book> books;
+        std::vector<long long> sequences;
+    };
+
+    Partition<PrintBook> printBooks;
+    Partition<AudioBook> audioBooks;
+    long long nextBackSequence;
+    long long nextFrontSequence;
+
+    template <typename Book>
+    Partition<Book> &partitionFor();
+    template <typename Book>
+    const Partition<Book> &partitionFor() const;
+
+    template <typename Book>
+    void insertInto(Book book, long long sequence);
+
+    /// Which partition holds the item at a global index (true for print books)
+    /// and its offset there; O(log^2 n).
+    std::pair<bool, int> locate(int index) const;
+
+public:
+    PartitionedReadingItemStore();
+
+    bool isEmpty() const;
+    int size() const;
+
+    /// Number of items of one concrete type, e.g. countOf<AudioBook>().
+    template <typename Book>
+    int countOf() const;
+
+    /// All items of one type, in list order, as one contiguous array.
+    template <typename Book>
+    const std::vector<Book> &itemsOf() const;
+
+    void insertBack(const PrintBook &book);
+    void insertBack(const AudioBook &book);
+
+    /// O(size of the book's partition): the front of a partition shifts.
+    void insertFront(const PrintBook &book);
+    void insertFront(const AudioBook &book);
+
+    /// Appends a copy of a polymorphic item to its type's partition. Throws
+    /// ContainerException if it is neither a PrintBook nor an AudioBook.
+    void insertCopy(const ReadingItem &item);
+
+    bool removeAt(int index);
+    bool deleteByTitle(std::string_view title);
+    int findByTitle(std::string_view title) const;
+
+    /// Item at a position of the mixed list order. Throws ContainerException
+    /// for an index out of range.
+    const ReadingItem *at(int index) const;
+
+    /// Items of one type that satisfy pred(const Book &), scanning only that
+    /// type's partition, e.g.
+    /// select<AudioBook>([](const AudioBook &book) { return book.getPrice().getIncludedWithSubscription(); }).
+    template <typename Book, typename Predicate>
+    std::vector<const Book *> select(Predicate pred) const;
+
+    /// Calls visitor(book) for every item in list order, with book as a
+    /// const PrintBook & or const AudioBook &.
+    template <typename Visitor>
+    void visitInOrder(Visitor &&visitor) const;
+
+    int getTotalPages() const;
+    double getTotalHours() const;
+
+    /// Node lines in list order, like the other lists' traverse.
+    void traverse(std::ostream &os = std::cout) const;
+
+    /// Full details grouped by type: all print books, then all audio books.
+    void printByType(std::ostream &os = std::cout) const;
+    void clear();
+};
+
+template <>
+inline PartitionedReadingItemStore::Partition<PrintBook> &PartitionedReadingItemStore::partitionFor<PrintBook>()
+{
+    return printBooks;
+}
+
+template <>
+inline PartitionedReadingItemStore::Partition<AudioBook> &PartitionedReadingItemStore::partitionFor<AudioBook>()
+{
+    return audioBooks;
+}
+
+template <>
+inline const PartitionedReadingItemStore::Partition<PrintBook> &
+PartitionedReadingItemStore::partitionFor<PrintBook>() const
+{
+    return printBooks;
+}
+
+template <>
+inline const PartitionedReadingItemStore::Partition<AudioBook> &
+PartitionedReadingItemStore::partitionFor<AudioBook>() const
+{
+    return audioBooks;
+}
+
+template <typename Book>
+void PartitionedReadingItemStore::insertInto(Book book, long long sequence)
+{
+    Partition<Book> &partition = partitionFor<Book>();
+    auto position = std::lower_bound(partition.sequences.begin(), partition.sequences.end(), sequence);
+    const auto offset = position - partition.sequences.begin();
+    partition.sequences.insert(position, sequence);
+    partition.books.insert(partition.books.begin() + offset, std::move(book));
+}
+
+template <typename Book>
+int PartitionedReadingItemStore::countOf() const
+{
+    return static_cast<int>(partitionFor<Book>().books.size());
+}
+
+template <typename Book>
+const std::vector<Book> &PartitionedReadingItemStore::itemsOf() const
+{
+    return partitionFor<Book>().books;
+}
+
+template <typename Book, typename Predicate>
+std::vector<const Book *> PartitionedReadingItemStore::select(Predicate pred) const
+{
+    std::vector<const Book *> matches;
+    for (const Book &book : partitionFor<Book>().books)
+    {
+        if (pred(book))
+        {
+            matches.push_back(&book);
+        }
+    }
+
+    return matches;
+}
+
+template <typename Visitor>
+void PartitionedReadingItemStore::visitInOrder(Visitor &&visitor) const
+{
+    std::size_t print = 0;
+    std::size_t audio = 0;
+    while (print < printBooks.books.size() || audio < audioBooks.books.size())
+    {
+        if (audio == audioBooks.books.size() ||
+            (print < printBooks.books.size() && printBooks.sequences[print] < audioBooks.sequences[audio]))
+        {
+            visitor(printBooks.books[print++]);
+        }
+        else
+        {
+            visitor(audioBooks.books[audio++]);
+        }
+    }
+}
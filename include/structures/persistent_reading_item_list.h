@@ -0,0 +1,107 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "common/container_exception.h"
+#include "models/reading_item.h"
+
+// Immutable node of a PersistentReadingItemList. Nodes are never modified after
+// construction, so any number of versions can share them.
+struct PersistentListNode
+{
+    std::shared_ptr<const ReadingItem> item;
+    std::shared_ptr<const PersistentListNode> left;
+    std::shared_ptr<const PersistentListNode> right;
+    int size;
+    int height;
+};
+
+using PersistentListNodePtr = std::shared_ptr<const PersistentListNode>;
+
+// In-order walk over one version; holds at most O(log n) pending nodes.
+class PersistentReadingItemListIterator
+{
+private:
+    std::vector<const PersistentListNode *> pending;
+
+    void pushLeftSpine(const PersistentListNode *node);
+
+public:
+    explicit PersistentReadingItemListIterator(const PersistentListNode *root = nullptr);
+
+    bool isValid() const;
+    void next();
+    const ReadingItem *getData() const;
+};
+
+// Items present in only one of two versions, compared by identity (unordered).
+struct PersistentListDiff
+{
+    std::vector<std::shared_ptr<const ReadingItem>> added;
+    std::vector<std::shared_ptr<const ReadingItem>> removed;
+};
+
+// One version of a list of reading items, stored as a persistent AVL tree keyed
+// by position (in-order = list order, each node counts its subtree). Updates
+// never modify a version: they return a new one that copies the O(log n) nodes
+// on the changed path and shares everything else. Copying a version is O(1).
+class PersistentReadingItemList
+{
+private:
+    PersistentListNodePtr root;
+
+    explicit PersistentReadingItemList(PersistentListNodePtr root);
+
+    static int sizeOf(const PersistentListNodePtr &node);
+    static int heightOf(const PersistentListNodePtr &node);
+    static PersistentListNodePtr makeNode(std::shared_ptr<const ReadingItem> item, PersistentListNodePtr left,
+                                          PersistentListNodePtr right);
+    static PersistentListNodePtr balance(std::shared_ptr<const ReadingItem> item, PersistentListNodePtr left,
+                                         PersistentListNodePtr right);
+    static PersistentListNodePtr build(const std::vector<std::shared_ptr<const ReadingItem>> &items,
+                                       int begin, int end);
+    static PersistentListNodePtr insertAt(const PersistentListNodePtr &node, int index,
+                                          std::shared_ptr<const ReadingItem> item);
+    static PersistentListNodePtr replaceAt(const PersistentListNodePtr &node, int index,
+                                           std::shared_ptr<const ReadingItem> item);
+    static PersistentListNodePtr removeAt(const PersistentListNodePtr &node, int index);
+    static PersistentListNodePtr removeFirst(const PersistentListNodePtr &node,
+                                             std::shared_ptr<const ReadingItem> &first);
+    static void appendItems(const PersistentListNodePtr &node, std::vector<std::shared_ptr<const ReadingItem>> &out);
+
+public:
+    PersistentReadingItemList();
+
+    /// Balanced version holding items in order, built in O(n).
+    static PersistentReadingItemList fromItems(const std::vector<std::shared_ptr<const ReadingItem>> &items);
+
+    bool isEmpty() const;
+    int size() const;
+
+    /// True when both versions share the same root, i.e. are the same version.
+    bool sameVersionAs(const PersistentReadingItemList &other) const;
+
+    /// O(log n). Throws ContainerException if index is out of range.
+    const ReadingItem *at(int index) const;
+    std::shared_ptr<const ReadingItem> shareAt(int index) const;
+
+    /// Shared handles to every item, in list order.
+    std::vector<std::shared_ptr<const ReadingItem>> toItems() const;
+
+    // Each returns a new version in O(log n); this version is unchanged.
+    // They throw ContainerException for a null item or an index out of range.
+    PersistentReadingItemList pushBack(std::shared_ptr<const ReadingItem> item) const;
+    PersistentReadingItemList insertAt(int index, std::shared_ptr<const ReadingItem> item) const;
+    PersistentReadingItemList removeAt(int index) const;
+    PersistentReadingItemList replaceAt(int index, std::shared_ptr<const ReadingItem> item) const;
+
+    PersistentReadingItemListIterator begin() const;
+    void traverse(std::ostream &os = std::cout) const;
+
+    /// Items added and removed going from older to newer. Subtrees the two versions
+    /// share are skipped without being visited, so the cost grows with the size of
+    /// the change (O(k log n) for k single-item updates), not with the library.
+    static PersistentListDiff diff(const PersistentReadingItemList &older, const PersistentReadingItemList &newer);
+};
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "common/container_exception.h"
+#include "structures/node_pool.h"
 
 struct QueueNode
 {
@@ -18,6 +20,7 @@ class Queue
 private:
     QueueNode *head;
     QueueNode *tail;
+    NodePool<QueueNode> nodes;
 
 public:
     Queue();
@@ -27,7 +30,11 @@ public:
     Queue &operator=(const Queue &) = delete;
 
     void enqueue(const std::string &value);
+
+    /// Enqueues in order with one pool reservation, moving the strings in.
+    void enqueueAll(std::vector<std::string> values);
     void dequeue();
     std::string front() const;
     bool isEmpty() const;
+    NodePoolStats getNodePoolStats() const;
 };
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+
+#include "common/difficulty.h"
+#include "models/reading_item.h"
+
+/// Every aggregate the report needs, computed together in one pass.
+struct LibraryTotals
+{
+    static const int DIFFICULTY_LEVELS = HARD - EASY + 1;
+
+    int itemCount = 0;
+    long long totalPages = 0;
+    double totalHours = 0.0;
+    double totalCost = 0.0;
+    int countByDifficulty[DIFFICULTY_LEVELS] = {};
+    long long pagesByDifficulty[DIFFICULTY_LEVELS] = {};
+    double hoursByDifficulty[DIFFICULTY_LEVELS] = {};
+
+    int countFor(Difficulty difficulty) const;
+    long long pagesFor(Difficulty difficulty) const;
+    double hoursFor(Difficulty difficulty) const;
+
+    /// Averages are 0 for an empty library (and speed for zero hours).
+    double averagePages() const;
+    double averageHours() const;
+    double averageSpeed() const;
+};
+
+// Struct-of-arrays mirror of the numeric fields of a set of items: pages, hours,
+// difficulty and cost each sit in their own contiguous array, one row per item,
+// so aggregates stream through a few arrays instead of chasing a node and an
+// item pointer per element. Rows are unordered (removal moves the last row into
+// the gap). The store attaches as each item's mirror observer with the row as
+// its slot, so the item setters refresh the row in O(1) and deleting an item
+// drops it. An item can be in at most one column store. Does not own the items.
+class ReadingItemColumns : private ReadingItemObserver
+{
+private:
+    std::vector<int> pages;
+    std::vector<double> hours;
+    std::vector<int> difficulties;
+    std::vector<double> costs;
+    std::vector<ReadingItem *> rowItems;
+
+    void writeRow(int row, const ReadingItem *item);
+
+    void titleChanging(ReadingItem &item, std::string_view newTitle) override;
+    void titleChanged(ReadingItem &item) override;
+    void fieldsChanging(ReadingItem &item) override;
+    void fieldsChanged(ReadingItem &item) override;
+    void itemDestroyed(ReadingItem &item) override;
+
+public:
+    ReadingItemColumns() = default;
+    ReadingItemColumns(const ReadingItemColumns &) = delete;
+    ReadingItemColumns &operator=(const ReadingItemColumns &) = delete;
+    ~ReadingItemColumns();
+
+    /// Throws ContainerException for a null item or one already in a column store.
+    void insert(ReadingItem *item);
+
+    /// O(1); false if the item is not in this store.
+    bool remove(ReadingItem *item);
+
+    bool contains(const ReadingItem *item) const;
+    void reserve(int capacity);
+    int size() const;
+    void clear();
+
+    /// Fused single pass over the columns. The loop keeps independent partial
+    /// sums per lane and selects per-difficulty values with masks instead of
+    /// branches, so the compiler can vectorize it.
+    LibraryTotals aggregate() const;
+};
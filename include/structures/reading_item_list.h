@@ -1,43 +1,231 @@
 #pragma once
 
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "common/container_exception.h"
 #include "models/reading_item.h"
+#include "structures/indexable_skip_list.h"
+#include "structures/node_pool.h"
+#include "structures/sort_keys.h"
+#include "structures/sorted_title_index.h"
+#include "structures/title_hash_index.h"
+
+// Whether a ReadingItemList accepts more than one item with the same title.
+enum DuplicateTitlePolicy
+{
+    ALLOW_DUPLICATE_TITLES,
+    REJECT_DUPLICATE_TITLES
+};
+
+// Where a ReadingItemList puts new items. TITLE_ORDER keeps the list sorted by
+// collation key: each insert links the item after its predecessor in the sorted
+// title index, found through the title hash index, so there is no list walk.
+enum ListOrder
+{
+    INSERTION_ORDER,
+    TITLE_ORDER
+};
 
 struct ReadingItemNode
 {
     ReadingItem *data;
     ReadingItemNode *next;
+    ReadingItemNode *prev;
+
+    // Next node with the same title, maintained by TitleHashIndex.
+    ReadingItemNode *nextSameTitle;
+
+    // Ordering key: increases from head to tail. Index = position - head->position
+    // while the list's positions are valid.
+    int position;
 
-    explicit ReadingItemNode(ReadingItem *data, ReadingItemNode *next = nullptr);
+    // This node's entry in the list's position index, if it keeps one.
+    IndexableSkipListNode<ReadingItemNode *> *positionEntry;
+
+    explicit ReadingItemNode(ReadingItem *data, ReadingItemNode *next = nullptr,
+                             ReadingItemNode *prev = nullptr);
 };
 
-class ReadingItemListIterator
+// Bidirectional iterator over a ReadingItemList that satisfies the standard
+// iterator requirements, so range-for and <algorithm>/<numeric> routines work on
+// the list. It also keeps the original isValid/next/getData interface.
+// Dereferencing yields the stored ReadingItem* by const reference (like a
+// const std::vector<ReadingItem *>), so iterators cannot re-seat list slots.
+// Reverse walks prev links instead of next links; `ends` points at the list's
+// tail (forward) or head (reverse) so stepping back from end() works.
+template <bool Reverse>
+class BasicReadingItemListIterator
 {
 private:
     ReadingItemNode *current;
+    ReadingItemNode *const *ends;
+
+    static ReadingItemNode *forward(ReadingItemNode *node) { return Reverse ? node->prev : node->next; }
+    static ReadingItemNode *backward(ReadingItemNode *node) { return Reverse ? node->next : node->prev; }
 
 public:
-    explicit ReadingItemListIterator(ReadingItemNode *start = nullptr);
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = ReadingItem *;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ReadingItem *const *;
+    using reference = ReadingItem *const &;
+
+    explicit BasicReadingItemListIterator(ReadingItemNode *start = nullptr,
+                                          ReadingItemNode *const *ends = nullptr)
+        : current(start), ends(ends) {}
+
+    bool isValid() const
+    {
+        return current != nullptr;
+    }
+
+    void next()
+    {
+        if (current != nullptr)
+        {
+            current = forward(current);
+        }
+    }
+
+    ReadingItem *getData() const
+    {
+        if (!isValid())
+        {
+            throw ContainerException("Iterator is out of range.");
+        }
+
+        return current->data;
+    }
 
-    bool isValid() const;
-    void next();
-    ReadingItem *getData() const;
+    reference operator*() const
+    {
+        return current->data;
+    }
+
+    pointer operator->() const
+    {
+        return &current->data;
+    }
+
+    BasicReadingItemListIterator &operator++()
+    {
+        current = forward(current);
+        return *this;
+    }
+
+    BasicReadingItemListIterator operator++(int)
+    {
+        BasicReadingItemListIterator previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    BasicReadingItemListIterator &operator--()
+    {
+        current = (current == nullptr) ? *ends : backward(current);
+        return *this;
+    }
+
+    BasicReadingItemListIterator operator--(int)
+    {
+        BasicReadingItemListIterator previous = *this;
+        --*this;
+        return previous;
+    }
+
+    bool operator==(const BasicReadingItemListIterator &other) const
+    {
+        return current == other.current;
+    }
+
+    bool operator!=(const BasicReadingItemListIterator &other) const
+    {
+        return current != other.current;
+    }
 };
 
-class ReadingItemList
+using ReadingItemListIterator = BasicReadingItemListIterator<false>;
+using ReadingItemListReverseIterator = BasicReadingItemListIterator<true>;
+
+// Owns its items and attaches itself to each one as its container observer, so
+// renaming an item through at() or an iterator re-keys the title indexes. An
+// item can be in only one list at a time.
+class ReadingItemList : private ReadingItemObserver
 {
 private:
     ReadingItemNode *head;
     ReadingItemNode *tail;
     int count;
+    DuplicateTitlePolicy duplicatePolicy;
+    ListOrder listOrder;
+    NodePool<ReadingItemNode> nodes;
+    SortedTitleIndex titleIndex;
+    TitleHashIndex titleLookup;
+
+    // Interior removals and sorting leave gaps or disorder in node positions;
+    // findByTitle renumbers once on demand instead of after every such change.
+    mutable bool positionsValid;
+
+    // Node of the item being renamed, between titleChanging and titleChanged.
+    ReadingItemNode *renamedNode;
+
+    // Owner-supplied observer that hears about item changes after the list has
+    // updated its own indexes.
+    ReadingItemObserver *itemObserver;
+
+    // The nodes again in list order, in an indexable skip list, when enabled by
+    // setPositionIndex; null otherwise.
+    std::unique_ptr<IndexableSkipList<ReadingItemNode *>> positionIndex;
 
     ReadingItemNode *nodeAt(int index) const;
+    void checkItem(ReadingItem *item) const;
+    void checkInsertable(ReadingItem *item) const;
+    void checkInsertable(const std::vector<ReadingItem *> &batch) const;
+    void checkDistinctTitles(const std::vector<ReadingItem *> &batch) const;
+    void attach(ReadingItem *item);
+    void indexPosition(ReadingItemNode *node);
+    void rebuildPositionIndex();
+    void linkAfter(ReadingItemNode *node, ReadingItemNode *predecessor);
+    void chainInListOrder(ReadingItemNode *node);
+    void insertInTitleOrder(ReadingItem *item);
+    void insertRangeInTitleOrder(const std::vector<ReadingItem *> &batch);
+    void restoreTitleOrder();
+    void mergeSortByTitle();
+    void unlink(ReadingItemNode *node);
+    void unlinkAndDelete(ReadingItemNode *node);
+    ReadingItem *unlinkAndRelease(ReadingItemNode *node);
+    std::vector<ReadingItem *> extractNodes(const std::vector<ReadingItemNode *> &doomed);
+    void renumberPositions() const;
+    std::vector<ReadingItemNode *> collectNodes() const;
+    void relinkInOrder(const std::vector<ReadingItemNode *> &order);
+
+    void titleChanging(ReadingItem &item, std::string_view newTitle) override;
+    void titleChanged(ReadingItem &item) override;
+    void fieldsChanging(ReadingItem &item) override;
+    void fieldsChanged(ReadingItem &item) override;
+    void itemDestroyed(ReadingItem &item) override;
+
+    static ReadingItemNode *splitAfter(ReadingItemNode *start, int length);
+    static ReadingItemNode *mergeByTitle(ReadingItemNode *left, ReadingItemNode *right,
+                                         ReadingItemNode *mergedTail);
 
 public:
-    ReadingItemList();
+    using value_type = ReadingItem *;
+    using size_type = int;
+    using difference_type = std::ptrdiff_t;
+    using iterator = ReadingItemListIterator;
+    using const_iterator = ReadingItemListIterator;
+    using reverse_iterator = ReadingItemListReverseIterator;
+    using const_reverse_iterator = ReadingItemListReverseIterator;
+
+    explicit ReadingItemList(DuplicateTitlePolicy duplicatePolicy = ALLOW_DUPLICATE_TITLES,
+                             ListOrder listOrder = INSERTION_ORDER);
     ReadingItemList(const ReadingItemList &) = delete;
     ReadingItemList &operator=(const ReadingItemList &) = delete;
     ~ReadingItemList();
@@ -45,17 +233,168 @@ public:
     bool isEmpty() const;
     int size() const;
 
-    ReadingItemListIterator begin() const;
+    iterator begin() const;
+    iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
 
+    /// Iterates from the back of the list to the front.
+    reverse_iterator rbegin() const;
+    reverse_iterator rend() const;
+
+    DuplicateTitlePolicy getDuplicatePolicy() const;
+    NodePoolStats getNodePoolStats() const;
+
+    /// Forwards every rename, field change and deletion of a listed item to
+    /// observer, so an owner can keep its own indexes in step. titleChanging and
+    /// fieldsChanging arrive while the item is still where it was; the others
+    /// once the list is up to date. A rename the list refuses is never forwarded.
+    /// nullptr stops it.
+    void setItemObserver(ReadingItemObserver *observer);
+
+    /// While enabled the list also keeps its nodes in an IndexableSkipList, so at,
+    /// handleAt, removeAt and findByTitle take expected O(log n) instead of a walk
+    /// or a renumbering pass. Every insert and removal pays O(log n) to keep it,
+    /// and sorts rebuild it. Enabling builds it once, in O(n log n).
+    void setPositionIndex(bool enabled);
+    bool hasPositionIndex() const;
+
+    /// Switching to TITLE_ORDER sorts the list once (stably); from then on
+    /// insertFront, insertBack, insertRange and splice all place items in title
+    /// order, with equal titles after the ones already there. Switching back keeps
+    /// the current order and appends again. sortBy leaves TITLE_ORDER.
+    void setOrder(ListOrder listOrder);
+    ListOrder getOrder() const;
+
+    /// Position of the item in title order, or -1 if it is not in the list. While
+    /// the list keeps TITLE_ORDER this is also its list index. O(log n + equal titles).
+    int titleRankOf(const ReadingItem *item) const;
+
+    /// Throws ContainerException for a null item, one already in a list, or a
+    /// repeated title when the list rejects duplicates (the caller keeps ownership
+    /// of the rejected item).
     void insertFront(ReadingItem *item);
     void insertBack(ReadingItem *item);
+
+    /// Inserts so the item ends up at index (0 <= index <= size()); throws
+    /// ContainerException for an index out of range, and like insertBack for the
+    /// item. With the position index this is expected O(log n): the neighbour is
+    /// found through the index and every title index update is O(log n) (plus the
+    /// duplicates of the item's title, if any). In TITLE_ORDER the item goes to
+    /// its place in title order instead.
+    void insertAt(int index, ReadingItem *item);
+
+    /// Appends the batch in order with one node reservation (in TITLE_ORDER,
+    /// merges the sorted batch into the list in one pass instead). The whole batch is validated first: on a
+    /// ContainerException nothing is inserted and the caller keeps ownership.
+    void insertRange(const std::vector<ReadingItem *> &batch);
+
+    /// Moves every item of other to the back of this list. Nodes are relinked, not
+    /// copied: their pool chunks move along with them, so only the title indexes
+    /// do per-item work. other ends up empty. Validated like insertRange.
+    void splice(ReadingItemList &other);
+
     bool removeAt(int index);
-    bool deleteByTitle(const std::string &title);
-    ReadingItem *searchByTitle(const std::string &title) const;
-    int findByTitle(const std::string &title) const;
+
+    /// Unlinks every item for which pred(ReadingItem *) is true and hands them to
+    /// the caller (detached from the list), in list order. pred is called once per item, front to back,
+    /// before anything changes, so a throwing pred leaves the list intact. One
+    /// traversal plus an O(log n) title index removal per match: O(n + k log n)
+    /// for k matches instead of an O(n) walk per removed item.
+    template <typename Predicate>
+    std::vector<ReadingItem *> extractIf(Predicate pred);
+
+    /// extractIf that deletes the matches; returns how many were removed.
+    template <typename Predicate>
+    int removeIf(Predicate pred);
+
+    /// Node handle for the item at index (nullptr if out of range). A handle stays
+    /// valid until that item is removed, whatever else is inserted or removed.
+    ReadingItemNode *handleAt(int index) const;
+
+    // Removal without a positional walk: the node is already known (handle) or is
+    // found through the title hash index (item). Unlinking the node is O(1); the
+    // whole removal is expected O(log n), for the sorted title index (and the
+    // position index, when enabled).
+    bool remove(ReadingItemNode *handle);
+    bool remove(ReadingItem *item);
+
+    /// Like remove(item), but hands the item back to the caller instead of
+    /// deleting it. Returns false (and keeps nothing) if the item is not listed.
+    bool extract(ReadingItem *item);
+
+    // Title lookups go through the title hash index: O(1) expected instead of a scan.
+    // With duplicate titles they act on the earliest matching item in list order.
+    bool deleteByTitle(std::string_view title);
+    ReadingItem *searchByTitle(std::string_view title) const;
+    int findByTitle(std::string_view title) const;
     ReadingItem *at(int index) const;
+
+    /// Index of a listed item, or -1 if it is not in this list. Expected O(log n)
+    /// with the position index; otherwise O(1) unless positions need renumbering.
+    int indexOf(const ReadingItem *item) const;
     void traverse(std::ostream &os = std::cout) const;
+
+    /// Title order here and in binarySearchByTitle and searchByTitlePrefix is
+    /// collation-key order, so "the hobbit" and "The Hobbit" sort together.
     void sortByTitle();
-    int binarySearchByTitle(const std::string &title) const;
+
+    /// Stable sort by the given keys (see sort_keys.h), most significant first.
+    /// Numeric keys are radix sorted and string keys merge sorted, each over an
+    /// array of node pointers; the nodes are relinked once at the end.
+    template <typename... Keys>
+    void sortBy();
+
+    /// Position of the title, ignoring case, in title order (the list index once
+    /// sorted), or -1.
+    /// Served from the maintained title index, so the list does not need sorting first.
+    int binarySearchByTitle(std::string_view title) const;
+
+    /// Items whose title starts with prefix, in title order, from the title index:
+    /// O(prefix * log n + matches), with no list walk and no title copies.
+    std::vector<ReadingItem *> searchByTitlePrefix(std::string_view prefix) const;
     void clear();
 };
+
+template <typename... Keys>
+void ReadingItemList::sortBy()
+{
+    static_assert(sizeof...(Keys) > 0, "sortBy needs at least one key.");
+    if (count < 2)
+    {
+        listOrder = INSERTION_ORDER;
+        return;
+    }
+
+    std::vector<ReadingItemNode *> order = collectNodes();
+    sortElementsByKeys<Keys...>(order, [](ReadingItemNode *node) { return node->data; });
+    relinkInOrder(order);
+    listOrder = INSERTION_ORDER;
+}
+
+template <typename Predicate>
+std::vector<ReadingItem *> ReadingItemList::extractIf(Predicate pred)
+{
+    std::vector<ReadingItemNode *> doomed;
+    for (ReadingItemNode *current = head; current != nullptr; current = current->next)
+    {
+        if (pred(current->data))
+        {
+            doomed.push_back(current);
+        }
+    }
+
+    return extractNodes(doomed);
+}
+
+template <typename Predicate>
+int ReadingItemList::removeIf(Predicate pred)
+{
+    std::vector<ReadingItem *> removed = extractIf(pred);
+    for (ReadingItem *item : removed)
+    {
+        delete item;
+    }
+
+    return static_cast<int>(removed.size());
+}
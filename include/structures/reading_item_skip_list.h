@@ -0,0 +1,59 @@
+#pragma once
+
+#include <iostream>
+#include <string_view>
+
+#include "common/container_exception.h"
+#include "models/reading_item.h"
+#include "structures/indexable_skip_list.h"
+
+using SkipListNode = IndexableSkipListNode<ReadingItem *>;
+
+class ReadingItemSkipListIterator
+{
+private:
+    SkipListNode *current;
+
+public:
+    explicit ReadingItemSkipListIterator(SkipListNode *start = nullptr);
+
+    bool isValid() const;
+    void next();
+    ReadingItem *getData() const;
+};
+
+// Indexable skip list with the same API as ReadingItemList, for callers that
+// mostly work by position. at, insertAt and removeAt run in expected O(log n)
+// instead of walking from the head. Title operations remain linear scans.
+// Owns its items like ReadingItemList does. ReadingItemList can keep the same
+// IndexableSkipList over its nodes (setPositionIndex) to get these bounds
+// together with its title indexes.
+class ReadingItemSkipList
+{
+private:
+    IndexableSkipList<ReadingItem *> entries;
+
+public:
+    ReadingItemSkipList();
+    ReadingItemSkipList(const ReadingItemSkipList &) = delete;
+    ReadingItemSkipList &operator=(const ReadingItemSkipList &) = delete;
+    ~ReadingItemSkipList();
+
+    bool isEmpty() const;
+    int size() const;
+
+    ReadingItemSkipListIterator begin() const;
+
+    void insertFront(ReadingItem *item);
+    void insertBack(ReadingItem *item);
+
+    /// Inserts so the item ends up at index (0 <= index <= size()).
+    void insertAt(int index, ReadingItem *item);
+    bool removeAt(int index);
+    bool deleteByTitle(std::string_view title);
+    ReadingItem *searchByTitle(std::string_view title) const;
+    int findByTitle(std::string_view title) const;
+    ReadingItem *at(int index) const;
+    void traverse(std::ostream &os = std::cout) const;
+    void clear();
+};
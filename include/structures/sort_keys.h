@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "models/reading_item.h"
+
+// Sort keys for ReadingItemList::sortBy and Manager::sortBy. A key is a type.
+// Numeric keys (isNumeric = true) map an item to an unsigned 64-bit value whose
+// unsigned order is the wanted order, so they can be radix sorted. Text keys
+// expose a view of the item's cached collation key, ordered byte-wise. Compose keys
+// as template arguments, most significant first:
+//     list.sortBy<SortByDifficulty, Descending<SortByHours>, SortByTitle>();
+
+// Order-preserving maps from signed and floating-point values to unsigned keys.
+inline std::uint64_t orderedSortKey(int value)
+{
+    return static_cast<std::uint32_t>(value) ^ 0x80000000u;
+}
+
+inline std::uint64_t orderedSortKey(double value)
+{
+    if (value == 0.0)
+    {
+        value = 0.0; // -0.0 and 0.0 compare equal, so give them one key.
+    }
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof bits);
+    const std::uint64_t signBit = std::uint64_t(1) << 63;
+    return (bits & signBit) ? ~bits : (bits | signBit);
+}
+
+struct SortByTitle
+{
+    static const bool isNumeric = false;
+    static const bool isDescending = false;
+    static std::string_view text(const ReadingItem &item) { return item.getCollationKey().full(); }
+};
+
+// Library order: "The Hobbit" files under H.
+struct SortByTitleIgnoringArticles
+{
+    static const bool isNumeric = false;
+    static const bool isDescending = false;
+    static std::string_view text(const ReadingItem &item) { return item.getCollationKey().withoutArticle(); }
+};
+
+struct SortByPages
+{
+    static const bool isNumeric = true;
+    static std::uint64_t key(const ReadingItem &item) { return orderedSortKey(item.getPages()); }
+};
+
+struct SortByHours
+{
+    static const bool isNumeric = true;
+    static std::uint64_t key(const ReadingItem &item) { return orderedSortKey(item.getHours()); }
+};
+
+struct SortByDifficulty
+{
+    static const bool isNumeric = true;
+    static std::uint64_t key(const ReadingItem &item) { return orderedSortKey(static_cast<int>(item.getDifficulty())); }
+};
+
+struct SortByCost
+{
+    static const bool isNumeric = true;
+    static std::uint64_t key(const ReadingItem &item) { return orderedSortKey(item.getPrice().getCost()); }
+};
+
+template <typename Key, bool Numeric = Key::isNumeric>
+struct Descending;
+
+template <typename Key>
+struct Descending<Key, true>
+{
+    static const bool isNumeric = true;
+    static std::uint64_t key(const ReadingItem &item) { return ~Key::key(item); }
+};
+
+template <typename Key>
+struct Descending<Key, false>
+{
+    static const bool isNumeric = false;
+    static const bool isDescending = !Key::isDescending;
+    static std::string_view text(const ReadingItem &item) { return Key::text(item); }
+};
+
+struct RadixSortEntry
+{
+    std::uint64_t key;
+    std::size_t index;
+};
+
+/// Stable LSD radix sort on key, one byte per pass. Only bytes that differ
+/// between keys get a pass, so small keys such as difficulty cost one pass.
+void radixSortByKey(std::vector<RadixSortEntry> &entries);
+
+// Stably reorder a permutation (indexes into the key column) by one key column.
+void refineOrderByNumericKey(const std::vector<std::uint64_t> &keys, std::vector<std::size_t> &order);
+void refineOrderByText(const std::vector<std::string_view> &texts, bool descending,
+                       std::vector<std::size_t> &order);
+
+// Per-element value stored for a key: the radix key, or a view of the text.
+template <typename Key>
+using SortColumn = std::vector<typename std::conditional<Key::isNumeric, std::uint64_t, std::string_view>::type>;
+
+template <typename Key>
+void appendSortColumnValue(SortColumn<Key> &column, const ReadingItem &item)
+{
+    if constexpr (Key::isNumeric)
+    {
+        column.push_back(Key::key(item));
+    }
+    else
+    {
+        column.push_back(Key::text(item));
+    }
+}
+
+template <typename Key>
+void refineOrderByKey(const SortColumn<Key> &column, std::vector<std::size_t> &order)
+{
+    if constexpr (Key::isNumeric)
+    {
+        refineOrderByNumericKey(column, order);
+    }
+    else
+    {
+        refineOrderByText(column, Key::isDescending, order);
+    }
+}
+
+template <typename... Keys, typename T, typename Projection, std::size_t... I>
+void sortElementsByKeys(std::vector<T> &elements, Projection project, std::index_sequence<I...>)
+{
+    const std::size_t keyCount = sizeof...(Keys);
+    using KeyList = std::tuple<Keys...>;
+
+    // Every key is read in one pass, so each item is visited once however many
+    // keys there are; later passes only touch the compact key columns.
+    std::tuple<SortColumn<Keys>...> columns;
+    (std::get<I>(columns).reserve(elements.size()), ...);
+    for (const T &element : elements)
+    {
+        const ReadingItem &item = *project(element);
+        (appendSortColumnValue<Keys>(std::get<I>(columns), item), ...);
+    }
+
+    // One stable pass per key, least significant first (LSD over the key list).
+    std::vector<std::size_t> order(elements.size());
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    (refineOrderByKey<typename std::tuple_element<keyCount - 1 - I, KeyList>::type>(
+         std::get<keyCount - 1 - I>(columns), order),
+     ...);
+
+    std::vector<T> sorted;
+    sorted.reserve(elements.size());
+    for (std::size_t index : order)
+    {
+        sorted.push_back(std::move(elements[index]));
+    }
+
+    elements.swap(sorted);
+}
+
+/// Stable multi-key sort of elements; project maps an element to a ReadingItem*.
+template <typename... Keys, typename T, typename Projection>
+void sortElementsByKeys(std::vector<T> &elements, Projection project)
+{
+    static_assert(sizeof...(Keys) > 0, "Sorting needs at least one key.");
+    sortElementsByKeys<Keys...>(elements, project, std::index_sequence_for<Keys...>());
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "models/reading_item.h"
+#include "structures/indexable_skip_list.h"
+#include "structures/title_arena.h"
+
+// Title-ordered sequence of item pointers kept in step with ReadingItemList.
+// Entries are ordered by collation key (case-folded title) and cache it, so
+// lookups compare plain bytes. The list removes an item before it is renamed
+// and re-inserts it after, so every entry is filed under its item's current key.
+// Entries live in an IndexableSkipList, so inserting, removing and finding an
+// entry, and an entry's position, all take expected O(log n): the list inserts
+// and removes one entry per item without shifting an array.
+// The cached keys live in the index's TitleArena and entries hold views.
+class SortedTitleIndex
+{
+private:
+    struct Entry
+    {
+        std::string_view key;
+        ReadingItem *item;
+    };
+
+    using EntryNode = IndexableSkipListNode<Entry>;
+
+    IndexableSkipList<Entry> entries;
+    TitleArena keys;
+
+    EntryNode *firstAtOrAfter(std::string_view key, int &position) const;
+    void compactKeysIfSparse();
+
+public:
+    SortedTitleIndex() = default;
+    SortedTitleIndex(const SortedTitleIndex &) = delete;
+    SortedTitleIndex &operator=(const SortedTitleIndex &) = delete;
+
+    /// Inserts after any entries with an equal key and returns the item just
+    /// before the new entry in title order (nullptr if it comes first).
+    ReadingItem *insert(ReadingItem *item);
+
+    /// Inserts the items in order, each after the equal keys already present
+    /// (earlier items of the batch included): O(k log n).
+    void insertBatch(const std::vector<ReadingItem *> &items);
+
+    /// Moves every entry of other into this index; other ends up empty.
+    void absorb(SortedTitleIndex &other);
+    bool remove(ReadingItem *item);
+    void removeBatch(const std::vector<ReadingItem *> &items);
+
+    /// Position of the first entry whose title equals title ignoring case, or -1.
+    int find(std::string_view title) const;
+    ReadingItem *itemAt(int position) const;
+
+    /// Position of this exact item, or -1: one descent, then a scan of the
+    /// entries that share its key.
+    int positionOf(const ReadingItem *item) const;
+
+    /// Items whose titles start with prefix, ignoring case, in title order: one
+    /// descent to the first match, then a walk that stops at the first miss.
+    std::vector<ReadingItem *> itemsWithPrefix(std::string_view prefix) const;
+
+    int size() const;
+    void clear();
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Bump arena for the title keys a library's indexes keep. Each stored string is
+// copied once into the current chunk and handed back as a view; chunks never
+// move, so views stay valid until clear(). Strings are not freed one by one:
+// release() only counts their bytes as dead, and the owner rebuilds the arena
+// (storing the live strings into a fresh one) once shouldCompact() says most of
+// it is dead.
+class TitleArena
+{
+private:
+    static const std::size_t CHUNK_SIZE = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> chunks;
+    char *bumpNext;
+    std::size_t bumpLeft;
+    std::size_t liveBytes;
+    std::size_t deadBytes;
+
+public:
+    TitleArena();
+    TitleArena(const TitleArena &) = delete;
+    TitleArena &operator=(const TitleArena &) = delete;
+    TitleArena(TitleArena &&other) noexcept;
+    TitleArena &operator=(TitleArena &&other) noexcept;
+
+    /// Copies text into the arena. Strings longer than a chunk get a chunk of their own.
+    std::string_view store(std::string_view text);
+
+    /// Marks a stored string as no longer used.
+    void release(std::string_view stored);
+
+    /// Takes over other's chunks, so views into them stay valid here; other is left empty.
+    void adopt(TitleArena &other);
+
+    /// True once dead bytes outnumber live ones by more than a chunk.
+    bool shouldCompact() const;
+
+    std::size_t getLiveBytes() const;
+    std::size_t getDeadBytes() const;
+    int chunkCount() const;
+    void clear();
+};
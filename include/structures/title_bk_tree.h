@@ -0,0 +1,62 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "models/reading_item.h"
+
+struct TitleMatch
+{
+    ReadingItem *item;
+    int distance;
+};
+
+// BK-tree over collation keys (case-folded titles) for "did you mean" lookups. Edit distance is
+// a metric, so a query within k of some title only needs to visit children
+// whose edge distance lies within k of the query's distance to their parent;
+// most of the tree is never compared. Each distinct folded title is one node
+// holding the items that share it. Nodes live in one vector and refer to each
+// other by index. A removed title leaves an empty node behind to keep routing
+// intact, and the tree is rebuilt once empty nodes outnumber live ones. Does
+// not own the items.
+class TitleBkTree
+{
+private:
+    struct Node
+    {
+        std::string key;
+        std::vector<ReadingItem *> items;
+        std::vector<std::pair<int, int>> children; // (edit distance to key, node index)
+    };
+
+    std::vector<Node> nodes;
+    int itemCount;
+    int emptyNodeCount;
+
+    static int bitParallelEditDistance(const std::string &shorter, const std::string &longer, int limit);
+    static int bandedEditDistance(const std::string &shorter, const std::string &longer, int limit);
+
+    int findNode(const std::string &key) const;
+    void insertKey(const std::string &key, const std::vector<ReadingItem *> &items);
+    void rebuild();
+
+public:
+    TitleBkTree();
+
+    /// Levenshtein distance, or limit + 1 as soon as it is known to exceed limit.
+    /// Bit-parallel when the shorter string has at most 64 characters, otherwise
+    /// a dynamic-programming band of width 2 * limit + 1.
+    static int editDistance(const std::string &left, const std::string &right, int limit);
+
+    void insert(ReadingItem *item);
+    void remove(ReadingItem *item);
+
+    /// Items whose collation key is within maxDistance edits of the folded title,
+    /// closest first and then in title order. Throws ContainerException for a
+    /// negative distance.
+    std::vector<TitleMatch> findWithin(const std::string &title, int maxDistance) const;
+
+    int size() const;
+    void clear();
+};
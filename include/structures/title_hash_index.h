@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "structures/title_arena.h"
+
+class ReadingItem;
+struct ReadingItemNode;
+
+// Open-addressing (linear probing) hash table from title to list node.
+// Each distinct title owns one slot; nodes that share a title are chained through
+// ReadingItemNode::nextSameTitle in list order, so duplicates stay findable and
+// the first chained node is always the earliest one in the list. Slot titles
+// are copies kept in a TitleArena, so a probe compares against a view and a
+// lookup never allocates.
+class TitleHashIndex
+{
+private:
+    enum SlotState
+    {
+        EMPTY,
+        OCCUPIED,
+        DELETED
+    };
+
+    struct Slot
+    {
+        SlotState state = EMPTY;
+        std::size_t hash = 0;
+        std::string_view title;
+        ReadingItemNode *first = nullptr;
+        ReadingItemNode *last = nullptr;
+    };
+
+    std::vector<Slot> slots;
+    TitleArena titles;
+    int occupiedCount;
+    int deletedCount;
+
+    static std::size_t hashOf(std::string_view title);
+    int findSlot(std::string_view title, std::size_t hash) const;
+    Slot &claimSlot(std::string_view title);
+    void rehash(int capacity);
+    bool unchain(Slot &slot, ReadingItemNode *node);
+
+public:
+    TitleHashIndex();
+
+    void insertFront(ReadingItemNode *node);
+    void insertBack(ReadingItemNode *node);
+
+    /// Chains the node among its duplicates by position; positions must be valid
+    /// whenever the title is already indexed.
+    void insertInOrder(ReadingItemNode *node);
+
+    /// Chains the node just before successor, a node already chained under the
+    /// same title, or at the end of its chain when successor is nullptr.
+    void insertBefore(ReadingItemNode *node, ReadingItemNode *successor);
+    void remove(ReadingItemNode *node);
+
+    /// Earliest node in list order with this title, or nullptr.
+    ReadingItemNode *find(std::string_view title) const;
+
+    /// Node holding exactly this item, or nullptr if the item is not indexed.
+    ReadingItemNode *nodeOf(const ReadingItem *item) const;
+
+    /// Puts each chain of duplicate titles back into node position order after the
+    /// list (all of whose nodes are passed in) was reordered. Only chains with more
+    /// than one node are looked up and touched.
+    void restoreChainOrder(const std::vector<ReadingItemNode *> &nodes);
+
+    int distinctTitleCount() const;
+    void clear();
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "models/reading_item.h"
+
+// Inverted index from collation-key (case-folded title) trigrams to the items whose titles
+// contain them, for substring search. Each posting list is kept sorted by item
+// address so lists intersect by galloping search, shortest list first.
+// Every item's key is kept as it was indexed: removal visits exactly the
+// postings the item was filed under, even if it has been renamed since, and
+// search verifies candidates against the same keys. search never modifies the
+// index, so concurrent const searches are safe. Does not own the items.
+class TrigramTitleIndex
+{
+private:
+    std::unordered_map<std::uint32_t, std::vector<ReadingItem *>> postings;
+    std::unordered_map<const ReadingItem *, std::string> indexedKeys;
+
+    static std::vector<std::uint32_t> trigramsOf(const std::string &foldedText);
+    static void intersectInto(std::vector<ReadingItem *> &candidates, const std::vector<ReadingItem *> &longer);
+    static bool erase(std::vector<ReadingItem *> &posting, ReadingItem *item);
+
+    const std::string &claimKey(ReadingItem *item);
+
+public:
+    /// Fragments shorter than three characters have no trigram to look up.
+    static bool isSearchable(const std::string &fragment);
+
+    /// Throws ContainerException for a null item or one that is already indexed.
+    void insert(ReadingItem *item);
+
+    /// Appends the batch to each posting list and re-sorts every touched list
+    /// once, so a bulk load costs one sort per list instead of one shift per item.
+    void insertBatch(const std::vector<ReadingItem *> &items);
+    void remove(ReadingItem *item);
+
+    /// Items whose title contains fragment, ignoring case, in no particular
+    /// order (callers that display them sort the usually short result). Throws ContainerException if the fragment is not searchable.
+    std::vector<ReadingItem *> search(const std::string &fragment) const;
+
+    int size() const;
+    void clear();
+};
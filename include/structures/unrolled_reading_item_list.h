@@ -0,0 +1,78 @@
+#pragma once
+
+#include <iostream>
+#include <string_view>
+
+#include "common/container_exception.h"
+#include "models/reading_item.h"
+
+// One block of an unrolled list: up to CAPACITY item pointers stored contiguously,
+// with itemCount of them in use starting at items[0].
+struct UnrolledBlock
+{
+    static const int CAPACITY = 32;
+    static const int HALF = CAPACITY / 2;
+
+    ReadingItem *items[CAPACITY];
+    int itemCount;
+    UnrolledBlock *next;
+
+    UnrolledBlock();
+};
+
+class UnrolledReadingItemListIterator
+{
+private:
+    UnrolledBlock *block;
+    int offset;
+
+public:
+    explicit UnrolledReadingItemListIterator(UnrolledBlock *start = nullptr);
+
+    bool isValid() const;
+    void next();
+    ReadingItem *getData() const;
+};
+
+// Unrolled linked list with the same API as ReadingItemList. Each block holds up
+// to 32 item pointers, so a full traversal touches one node per 32 items instead
+// of one per item, and inserts allocate a block only when the end block is full.
+// Removals shift within a block; a block that drops below half full borrows an
+// item from a neighbour that can spare one or else merges with it, so every
+// block a removal leaves behind (other than a lone one) is at least half full.
+// Owns its items like ReadingItemList does.
+class UnrolledReadingItemList
+{
+private:
+    UnrolledBlock *head;
+    UnrolledBlock *tail;
+    int count;
+    int blocks;
+
+    UnrolledBlock *blockAt(int &index, UnrolledBlock **previous) const;
+    void unlinkBlock(UnrolledBlock *block, UnrolledBlock *previous);
+    void rebalance(UnrolledBlock *block, UnrolledBlock *previous);
+    void mergeInto(UnrolledBlock *target, UnrolledBlock *source);
+
+public:
+    UnrolledReadingItemList();
+    UnrolledReadingItemList(const UnrolledReadingItemList &) = delete;
+    UnrolledReadingItemList &operator=(const UnrolledReadingItemList &) = delete;
+    ~UnrolledReadingItemList();
+
+    bool isEmpty() const;
+    int size() const;
+    int blockCount() const;
+
+    UnrolledReadingItemListIterator begin() const;
+
+    void insertFront(ReadingItem *item);
+    void insertBack(ReadingItem *item);
+    bool removeAt(int index);
+    bool deleteByTitle(std::string_view title);
+    ReadingItem *searchByTitle(std::string_view title) const;
+    int findByTitle(std::string_view title) const;
+    ReadingItem *at(int index) const;
+    void traverse(std::ostream &os = std::cout) const;
+    void clear();
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <iostream>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "common/container_exception.h"
+#include "models/audio_book.h"
+#include "models/print_book.h"
+
+/// A reading item held by value; the alternative is its concrete type.
+using ReadingItemValue = std::variant<PrintBook, AudioBook>;
+
+/// The ReadingItem base of a stored value, for code written against ReadingItem.
+ReadingItem &asReadingItem(ReadingItemValue &value);
+const ReadingItem &asReadingItem(const ReadingItemValue &value);
+
+// Library storage that keeps items by value instead of as separately allocated
+// ReadingItem pointers. Values sit in chunks of up to CHUNK_CAPACITY contiguous
+// variants, so a traversal reads memory in order, and visit() hands each value to
+// the visitor as its concrete PrintBook or AudioBook. Both classes are final, so
+// calls made on them (displayName, toStream, print) bind statically and can be
+// inlined rather than going through the vtable.
+// Appends never move stored values. insertFront and removals shift values
+// within one chunk (a removal may also merge two half-empty chunks), so
+// ReadingItem pointers returned by at() or searchByTitle() stay valid until the
+// next insertFront, removal or clear. Stored values are copies: they should not be
+// linked into an ArrayLinkedReadingItemList or a ReadingItemColumns store.
+class VariantReadingItemList
+{
+public:
+    static const int CHUNK_CAPACITY = 64;
+
+private:
+    std::vector<std::vector<ReadingItemValue>> chunks;
+    int count;
+
+    std::vector<ReadingItemValue> &chunkForBack();
+    std::pair<int, int> locate(int index) const;
+
+public:
+    VariantReadingItemList();
+
+    bool isEmpty() const;
+    int size() const;
+    int chunkCount() const;
+
+    void insertFront(ReadingItemValue value);
+    void insertBack(ReadingItemValue value);
+
+    /// Constructs a Book (PrintBook or AudioBook) in place at the back.
+    template <typename Book, typename... Args>
+    ReadingItem &emplaceBack(Args &&...args);
+
+    /// Appends a copy of a polymorphic item. Throws ContainerException if it is
+    /// neither a PrintBook nor an AudioBook.
+    void insertCopy(const ReadingItem &item);
+
+    bool removeAt(int index);
+    bool deleteByTitle(std::string_view title);
+    ReadingItem *searchByTitle(std::string_view title);
+    int findByTitle(std::string_view title) const;
+
+    /// O(n / CHUNK_CAPACITY). Throws ContainerException for an index out of range.
+    ReadingItem *at(int index);
+    const ReadingItem *at(int index) const;
+
+    /// Calls visitor(book) for every value in list order, where book is a
+    /// PrintBook & or AudioBook &, e.g. visit([](const auto &book) { ... }).
+    template <typename Visitor>
+    void visit(Visitor &&visitor);
+    template <typename Visitor>
+    void visit(Visitor &&visitor) const;
+
+    int getTotalPages() const;
+    double getTotalHours() const;
+
+    void traverse(std::ostream &os = std::cout) const;
+    void clear();
+};
+
+template <typename Book, typename... Args>
+ReadingItem &VariantReadingItemList::emplaceBack(Args &&...args)
+{
+    std::vector<ReadingItemValue> &chunk = chunkForBack();
+    ReadingItemValue &value = chunk.emplace_back(std::in_place_type<Book>, std::forward<Args>(args)...);
+    count++;
+    return std::get<Book>(value);
+}
+
+template <typename Visitor>
+void VariantReadingItemList::visit(Visitor &&visitor)
+{
+    for (std::vector<ReadingItemValue> &chunk : chunks)
+    {
+        for (ReadingItemValue &value : chunk)
+        {
+            std::visit(visitor, value);
+        }
+    }
+}
+
+template <typename Visitor>
+void VariantReadingItemList::visit(Visitor &&visitor) const
+{
+    for (const std::vector<ReadingItemValue> &chunk : chunks)
+    {
+        for (const ReadingItemValue &value : chunk)
+        {
+            std::visit(visitor, value);
+        }
+    }
+}
@@ -1,10 +1,13 @@
 #include "app/manager.h"
 #include "external/json.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <unordered_map>
+#include <utility>
 
 bool Manager::isNonEmpty(const std::string &value) const
 {
@@ -141,39 +144,60 @@ bool Manager::loadItemsFromJson(const std::string &filePath)
             return false;
         }
 
-        // JSON data is converted into existing ReadingItem objects and inserted
-        // into the same linked-list/map-backed flow used by normal UI additions.
-        for (const auto &entry : jsonData)
+        // JSON data is converted into existing ReadingItem objects first and only
+        // added once every entry parsed, so a bad file leaves the library unchanged.
+        std::vector<ReadingItem *> batch;
+        auto discardBatch = [&batch]()
         {
-            const std::string type = entry.at("type").get<std::string>();
-            const std::string title = entry.at("title").get<std::string>();
-            const int pages = entry.at("pages").get<int>();
-            const double hours = entry.at("hours").get<double>();
-            const int difficultyValue = entry.at("difficulty").get<int>();
-            if (difficultyValue < EASY || difficultyValue > HARD)
+            for (ReadingItem *item : batch)
             {
-                return false;
+                delete item;
             }
-            const Difficulty difficulty = static_cast<Difficulty>(difficultyValue);
-            const double cost = entry.value("cost", 0.0);
-            const bool included = entry.value("included", false);
-            PriceInfo price(cost, included);
+        };
 
-            if (type == "print")
-            {
-                const std::string author = entry.at("author").get<std::string>();
-                addItem(new PrintBook(title, pages, hours, difficulty, author, price));
-            }
-            else if (type == "audio")
-            {
-                const std::string narrator = entry.at("narrator").get<std::string>();
-                addItem(new AudioBook(title, pages, hours, difficulty, narrator, price));
-            }
-            else
+        try
+        {
+            for (const auto &entry : jsonData)
             {
-                return false;
+                const std::string type = entry.at("type").get<std::string>();
+                const std::string title = entry.at("title").get<std::string>();
+                const int pages = entry.at("pages").get<int>();
+                const double hours = entry.at("hours").get<double>();
+                const int difficultyValue = entry.at("difficulty").get<int>();
+                if (difficultyValue < EASY || difficultyValue > HARD)
+                {
+                    discardBatch();
+                    return false;
+                }
+                const Difficulty difficulty = static_cast<Difficulty>(difficultyValue);
+                const double cost = entry.value("cost", 0.0);
+                const bool included = entry.value("included", false);
+                PriceInfo price(cost, included);
+
+                if (type == "print")
+                {
+                    const std::string author = entry.at("author").get<std::string>();
+                    batch.push_back(new PrintBook(title, pages, hours, difficulty, author, price));
+                }
+                else if (type == "audio")
+                {
+                    const std::string narrator = entry.at("narrator").get<std::string>();
+                    batch.push_back(new AudioBook(title, pages, hours, difficulty, narrator, price));
+                }
+                else
+                {
+                    discardBatch();
+                    return false;
+                }
             }
         }
+        catch (...)
+        {
+            discardBatch();
+            throw;
+        }
+
+        addItems(batch);
     }
     catch (const std::exception &)
     {
@@ -193,19 +217,37 @@ void Manager::removeItemUI()
 
     std::cout << "\n--- Remove Item ---\n";
     int itemNumber = 1;
-    for (ReadingItemListIterator it = items.begin(); it.isValid(); it.next(), itemNumber++)
+    for (const ReadingItem *item : items)
     {
-        std::cout << itemNumber << ". " << it.getData()->displayName() << "\n";
+        std::cout << itemNumber++ << ". ";
+        item->writeDisplayName(std::cout);
+        std::cout << "\n";
     }
 
-    int index = readChoice("Select item to remove (0 to cancel): ", 0, getItemCount());
-    if (index > 0)
+    const int removeByDifficulty = getItemCount() + 1;
+    std::cout << removeByDifficulty << ". All items of one difficulty\n";
+
+    int index = readChoice("Select item to remove (0 to cancel): ", 0, removeByDifficulty);
+    if (index == removeByDifficulty)
+    {
+        const Difficulty difficulty = readDifficulty();
+        const int removed =
+            removeWhere([difficulty](const ReadingItem *item) { return item->getDifficulty() == difficulty; });
+        std::cout << "\n" << removed << " item(s) removed.\n";
+    }
+    else if (index > 0)
     {
         removeItem(index - 1);
         std::cout << "\nItem removed.\n";
     }
 }
 
+Manager::Manager()
+{
+    items.setItemObserver(this);
+    items.setPositionIndex(true);
+}
+
 bool Manager::isEmpty() const
 {
     return items.isEmpty();
@@ -214,7 +256,17 @@ bool Manager::isEmpty() const
 Manager &Manager::operator+=(ReadingItem *item)
 {
     items.insertBack(item);
+    titleTrigrams.insert(item);
+    titleTree.insert(item);
+    columns.insert(item);
     difficultyCounts[item->getDifficulty()]++;
+    if (isHistoryEnabled())
+    {
+        std::shared_ptr<const ReadingItem> copy(item->clone());
+        recordVersion(isKeptSortedByTitle() ? versions.back().insertAt(items.titleRankOf(item), copy)
+                                            : versions.back().pushBack(copy));
+    }
+
     return *this;
 }
 
@@ -247,6 +299,61 @@ void Manager::addItem(ReadingItem *item)
     }
 }
 
+void Manager::addItems(const std::vector<ReadingItem *> &batch)
+{
+    items.insertRange(batch);
+
+    std::map<Difficulty, int> addedCounts;
+    columns.reserve(columns.size() + static_cast<int>(batch.size()));
+    titleTrigrams.insertBatch(batch);
+    for (ReadingItem *item : batch)
+    {
+        titleTree.insert(item);
+        columns.insert(item);
+        addedCounts[item->getDifficulty()]++;
+        if (!recentAdditions.isFull())
+        {
+            recentAdditions.push(item->getTitle());
+        }
+    }
+
+    for (const auto &entry : addedCounts)
+    {
+        difficultyCounts[entry.first] += entry.second;
+    }
+
+    // The whole batch becomes one version, so an import can be undone as a unit.
+    if (isHistoryEnabled() && !batch.empty())
+    {
+        PersistentReadingItemList version = versions.back();
+        if (isKeptSortedByTitle())
+        {
+            // Inserting at the final positions in ascending order leaves each clone
+            // where the live list put its item.
+            std::vector<std::pair<int, ReadingItem *>> placed;
+            for (ReadingItem *item : batch)
+            {
+                placed.push_back({items.titleRankOf(item), item});
+            }
+
+            std::sort(placed.begin(), placed.end());
+            for (const std::pair<int, ReadingItem *> &entry : placed)
+            {
+                version = version.insertAt(entry.first, std::shared_ptr<const ReadingItem>(entry.second->clone()));
+            }
+        }
+        else
+        {
+            for (ReadingItem *item : batch)
+            {
+                version = version.pushBack(std::shared_ptr<const ReadingItem>(item->clone()));
+            }
+        }
+
+        recordVersion(version);
+    }
+}
+
 bool Manager::removeItem(int index)
 {
     if (index < 0 || index >= getItemCount())
@@ -254,24 +361,59 @@ bool Manager::removeItem(int index)
         return false;
     }
 
-    ReadingItem *target = (*this)[index];
-    std::string title = target->getTitle();
-    const Difficulty difficulty = target->getDifficulty();
-    bool removed = items.removeAt(index);
-    if (removed)
+    // The position index finds the item in O(log n) and keeps it current as the
+    // item is unlinked. The other indexes only drop it once the list has let it go.
+    ReadingItem *target = items.at(index);
+    if (!items.extract(target))
     {
-        removedTitles.enqueue(title);
-        auto countIt = difficultyCounts.find(difficulty);
-        if (countIt != difficultyCounts.end())
+        return false;
+    }
+
+    forgetRemovedItems({target}, {index});
+    return true;
+}
+
+void Manager::forgetRemovedItems(const std::vector<ReadingItem *> &removed, const std::vector<int> &removedIndexes)
+{
+    if (removed.empty())
+    {
+        return;
+    }
+
+    std::vector<std::string> titles;
+    std::map<Difficulty, int> removedCounts;
+    titles.reserve(removed.size());
+    for (ReadingItem *item : removed)
+    {
+        titles.push_back(item->getTitle());
+        removedCounts[item->getDifficulty()]++;
+        titleTrigrams.remove(item);
+        titleTree.remove(item);
+        columns.remove(item);
+        delete item;
+    }
+
+    removedTitles.enqueueAll(std::move(titles));
+    for (const auto &entry : removedCounts)
+    {
+        auto countIt = difficultyCounts.find(entry.first);
+        if (countIt != difficultyCounts.end() && (countIt->second -= entry.second) <= 0)
         {
-            if (--countIt->second <= 0)
-            {
-                difficultyCounts.erase(countIt);
-            }
+            difficultyCounts.erase(countIt);
         }
     }
 
-    return removed;
+    if (isHistoryEnabled())
+    {
+        // Back to front, so earlier indexes still name the same items.
+        PersistentReadingItemList version = versions.back();
+        for (auto it = removedIndexes.rbegin(); it != removedIndexes.rend(); ++it)
+        {
+            version = version.removeAt(*it);
+        }
+
+        recordVersion(version);
+    }
 }
 
 int Manager::getItemCount() const
@@ -281,44 +423,306 @@ int Manager::getItemCount() const
 
 int Manager::getTotalPages() const
 {
-    int totalPages = 0;
-    for (ReadingItemListIterator it = items.begin(); it.isValid(); it.next())
+    return static_cast<int>(getTotals().totalPages);
+}
+
+double Manager::getTotalHours() const
+{
+    return getTotals().totalHours;
+}
+
+LibraryTotals Manager::getTotals() const
+{
+    return columns.aggregate();
+}
+
+int Manager::sequentialSearchByTitle(std::string_view title) const
+{
+    return items.findByTitle(title);
+}
+
+void Manager::sortByTitle()
+{
+    if (isKeptSortedByTitle())
     {
-        totalPages += it.getData()->getPages();
+        return;
     }
 
-    return totalPages;
+    const std::vector<ReadingItem *> before = orderBeforeReorder();
+    items.sortByTitle();
+    recordReorder(before);
 }
 
-double Manager::getTotalHours() const
+// The live order before a sort, which is also the order of the newest version's
+// clones; empty while history is off.
+std::vector<ReadingItem *> Manager::orderBeforeReorder() const
+{
+    return isHistoryEnabled() ? std::vector<ReadingItem *>(items.begin(), items.end()) : std::vector<ReadingItem *>();
+}
+
+// Pairs each live item with its clone by their shared starting order, then lays
+// the clones out in the list's new order. The clones are not sorted themselves,
+// so the version follows the list exactly, whatever the sort compared.
+void Manager::recordReorder(const std::vector<ReadingItem *> &before)
 {
-    double totalHours = 0.0;
-    for (ReadingItemListIterator it = items.begin(); it.isValid(); it.next())
+    if (!isHistoryEnabled())
     {
-        totalHours += it.getData()->getHours();
+        return;
+    }
+
+    const std::vector<std::shared_ptr<const ReadingItem>> clones = versions.back().toItems();
+    std::unordered_map<const ReadingItem *, std::shared_ptr<const ReadingItem>> cloneOf;
+    cloneOf.reserve(before.size());
+    for (std::size_t i = 0; i < before.size(); i++)
+    {
+        cloneOf.emplace(before[i], clones[i]);
+    }
+
+    std::vector<std::shared_ptr<const ReadingItem>> reordered;
+    reordered.reserve(before.size());
+    for (const ReadingItem *item : items)
+    {
+        reordered.push_back(cloneOf.at(item));
     }
 
-    return totalHours;
+    recordVersion(PersistentReadingItemList::fromItems(reordered));
 }
 
-int Manager::sequentialSearchByTitle(const std::string &title) const
+void Manager::setKeepSortedByTitle(bool enabled)
 {
-    return items.findByTitle(title);
+    if (enabled == isKeptSortedByTitle())
+    {
+        return;
+    }
+
+    // Switching to title order sorts the list once; history records that sort
+    // as a version, the same way sortByTitle does.
+    const std::vector<ReadingItem *> before = enabled ? orderBeforeReorder() : std::vector<ReadingItem *>();
+    items.setOrder(enabled ? TITLE_ORDER : INSERTION_ORDER);
+    if (enabled)
+    {
+        recordReorder(before);
+    }
 }
 
-void Manager::sortByTitle()
+bool Manager::isKeptSortedByTitle() const
 {
-    items.sortByTitle();
+    return items.getOrder() == TITLE_ORDER;
+}
+
+void Manager::sortLibraryUI()
+{
+    std::cout << "\n--- Sort Library ---\n";
+    std::cout << "1. Title\n";
+    std::cout << "2. Pages\n";
+    std::cout << "3. Hours\n";
+    std::cout << "4. Difficulty\n";
+    std::cout << "5. Cost\n";
+    std::cout << "6. Difficulty, then longest first\n";
+    std::cout << "7. Title, ignoring A / An / The\n";
+    std::cout << "8. " << (isKeptSortedByTitle() ? "Stop keeping" : "Keep") << " the library in title order\n";
+
+    switch (readChoice("Sort by: ", 1, 8))
+    {
+    case 1:
+        sortByTitle();
+        std::cout << "\nLibrary sorted by title.\n";
+        break;
+    case 2:
+        sortBy<SortByPages>();
+        std::cout << "\nLibrary sorted by pages.\n";
+        break;
+    case 3:
+        sortBy<SortByHours>();
+        std::cout << "\nLibrary sorted by hours.\n";
+        break;
+    case 4:
+        sortBy<SortByDifficulty>();
+        std::cout << "\nLibrary sorted by difficulty.\n";
+        break;
+    case 5:
+        sortBy<SortByCost>();
+        std::cout << "\nLibrary sorted by cost.\n";
+        break;
+    case 6:
+        sortBy<SortByDifficulty, Descending<SortByHours>>();
+        std::cout << "\nLibrary sorted by difficulty, then hours (longest first).\n";
+        break;
+    case 7:
+        sortBy<SortByTitleIgnoringArticles>();
+        std::cout << "\nLibrary sorted by title, ignoring leading articles.\n";
+        break;
+    default:
+        setKeepSortedByTitle(!isKeptSortedByTitle());
+        std::cout << (isKeptSortedByTitle() ? "\nNew items will be added in title order.\n"
+                                            : "\nNew items will be added at the end.\n");
+        break;
+    }
+}
+
+void Manager::enableHistory(int maxVersions)
+{
+    if (maxVersions < 1)
+    {
+        throw ContainerException("History must keep at least one version.");
+    }
+
+    if (!isHistoryEnabled())
+    {
+        std::vector<std::shared_ptr<const ReadingItem>> clones;
+        for (const ReadingItem *item : items)
+        {
+            clones.emplace_back(item->clone());
+        }
+
+        versions.push_back(PersistentReadingItemList::fromItems(clones));
+    }
+
+    this->maxVersions = maxVersions;
+    while (static_cast<int>(versions.size()) > maxVersions)
+    {
+        versions.pop_front();
+    }
+}
+
+// Called by the list around a rename, with the old title still in place here, so
+// both title indexes drop the old key before filing the new one. History swaps
+// the item's clone for a renamed one; in title order the rename may also move
+// the item, so the clone leaves the old index and joins at the new one.
+void Manager::titleChanging(ReadingItem &item, std::string_view)
+{
+    titleTrigrams.remove(&item);
+    titleTree.remove(&item);
+    renamedIndex = isHistoryEnabled() ? items.indexOf(&item) : -1;
+}
+
+void Manager::titleChanged(ReadingItem &item)
+{
+    titleTrigrams.insert(&item);
+    titleTree.insert(&item);
+    if (renamedIndex != -1)
+    {
+        std::shared_ptr<const ReadingItem> copy(item.clone());
+        const int index = items.indexOf(&item);
+        recordVersion(index == renamedIndex ? versions.back().replaceAt(index, copy)
+                                            : versions.back().removeAt(renamedIndex).insertAt(index, copy));
+        renamedIndex = -1;
+    }
+}
+
+// A field change may move the item to another difficulty: uncount it under the
+// old one here and count it again once the new values are in.
+void Manager::fieldsChanging(ReadingItem &item)
+{
+    auto countIt = difficultyCounts.find(item.getDifficulty());
+    if (countIt != difficultyCounts.end() && --countIt->second <= 0)
+    {
+        difficultyCounts.erase(countIt);
+    }
+}
+
+void Manager::fieldsChanged(ReadingItem &item)
+{
+    difficultyCounts[item.getDifficulty()]++;
+    if (isHistoryEnabled())
+    {
+        recordVersion(versions.back().replaceAt(items.indexOf(&item), std::shared_ptr<const ReadingItem>(item.clone())));
+    }
+}
+
+// The item was deleted behind the Manager's back; the list has already dropped it.
+void Manager::itemDestroyed(ReadingItem &item)
+{
+    titleTrigrams.remove(&item);
+    titleTree.remove(&item);
+    auto countIt = difficultyCounts.find(item.getDifficulty());
+    if (countIt != difficultyCounts.end() && --countIt->second <= 0)
+    {
+        difficultyCounts.erase(countIt);
+    }
+}
+
+bool Manager::isHistoryEnabled() const
+{
+    return maxVersions > 0;
 }
 
-int Manager::binarySearchByTitle(const std::string &title) const
+int Manager::getVersionCount() const
+{
+    return static_cast<int>(versions.size());
+}
+
+const PersistentReadingItemList &Manager::getVersion(int version) const
+{
+    if (version < 0 || version >= getVersionCount())
+    {
+        throw ContainerException("Version out of range.");
+    }
+
+    return versions[version];
+}
+
+PersistentListDiff Manager::diffVersions(int olderVersion, int newerVersion) const
+{
+    return PersistentReadingItemList::diff(getVersion(olderVersion), getVersion(newerVersion));
+}
+
+void Manager::recordVersion(const PersistentReadingItemList &version)
+{
+    versions.push_back(version);
+    if (static_cast<int>(versions.size()) > maxVersions)
+    {
+        versions.pop_front();
+    }
+}
+
+int Manager::binarySearchByTitle(std::string_view title) const
 {
     return items.binarySearchByTitle(title);
 }
 
+std::vector<ReadingItem *> Manager::searchByTitlePrefix(std::string_view prefix) const
+{
+    return items.searchByTitlePrefix(prefix);
+}
+
+std::vector<ReadingItem *> Manager::searchByTitleFragment(const std::string &fragment) const
+{
+    std::vector<ReadingItem *> matches;
+    if (TrigramTitleIndex::isSearchable(fragment))
+    {
+        matches = titleTrigrams.search(fragment);
+    }
+    else
+    {
+        const std::string foldedFragment = foldTitle(fragment);
+        for (ReadingItem *item : items)
+        {
+            if (item->getCollationKey().full().find(foldedFragment) != std::string::npos)
+            {
+                matches.push_back(item);
+            }
+        }
+    }
+
+    sortElementsByKeys<SortByTitle>(matches, [](const ReadingItem *item) { return item; });
+    return matches;
+}
+
+std::vector<ReadingItem *> Manager::suggestTitles(const std::string &title, int maxDistance) const
+{
+    std::vector<ReadingItem *> suggestions;
+    for (const TitleMatch &match : titleTree.findWithin(title, maxDistance))
+    {
+        suggestions.push_back(match.item);
+    }
+
+    return suggestions;
+}
+
 double Manager::getAvgSpeed() const
 {
-    return safeDivide(static_cast<double>(getTotalPages()), getTotalHours());
+    return getTotals().averageSpeed();
 }
 
 int Manager::countByDifficulty(Difficulty difficulty) const
@@ -367,7 +771,7 @@ void Manager::showMenu() const
     std::cout << "3. Remove Item\n";
     std::cout << "4. View Report\n";
     std::cout << "5. Save Report to File\n";
-    std::cout << "6. Sort by Title\n";
+    std::cout << "6. Sort Library\n";
     std::cout << "7. Search by Title\n";
     std::cout << "8. Load Items from JSON\n";
     std::cout << "9. Exit\n";
@@ -384,22 +788,28 @@ void Manager::showReport()
     {
         std::cout << "\n--- Reading Report ---\n";
         std::cout << "Total items: " << getItemCount() << "\n";
-        std::cout << "Storage: unordered linked list\n";
+        std::cout << "Storage: " << (isKeptSortedByTitle() ? "linked list kept in title order" : "unordered linked list") << "\n";
+
+        // One pass over the columns yields every figure below.
+        const LibraryTotals totals = getTotals();
+        std::cout << std::fixed << std::setprecision(1);
 
         if (!difficultyCounts.empty())
         {
             std::cout << "\n--- Difficulty counts (std::map) ---\n";
             for (const auto &entry : difficultyCounts)
             {
-                std::cout << "  " << difficultyToString(entry.first) << ": " << entry.second << "\n";
+                std::cout << "  " << difficultyToString(entry.first) << ": " << entry.second << " ("
+                          << totals.pagesFor(entry.first) << " pages, " << totals.hoursFor(entry.first)
+                          << " hours)\n";
             }
         }
 
-        double totalHours = getTotalHours();
-        double avgSpeed = getAvgSpeed();
+        double totalHours = totals.totalHours;
+        double avgSpeed = totals.averageSpeed();
 
-        std::cout << std::fixed << std::setprecision(1);
         std::cout << "Total hours: " << totalHours << "\n";
+        std::cout << "Avg pages per item: " << totals.averagePages() << "\n";
         std::cout << "Avg speed: " << avgSpeed << " pages/hour\n";
 
         int hardCount = countByDifficulty(HARD);
@@ -414,10 +824,12 @@ void Manager::showReport()
 
         std::cout << "\n--- Items ---\n";
         int itemNumber = 1;
-        for (ReadingItemListIterator it = items.begin(); it.isValid(); it.next(), itemNumber++)
+        for (const ReadingItem *item : items)
         {
-            std::cout << "\nItem " << itemNumber << ": " << it.getData()->displayName() << "\n";
-            it.getData()->print(std::cout);
+            std::cout << "\nItem " << itemNumber++ << ": ";
+            item->writeDisplayName(std::cout);
+            std::cout << "\n";
+            item->print(std::cout);
         }
     }
 
@@ -451,10 +863,12 @@ void Manager::saveToFile() const
     file << "Total items: " << getItemCount() << "\n\n";
 
     int itemNumber = 1;
-    for (ReadingItemListIterator it = items.begin(); it.isValid(); it.next(), itemNumber++)
+    for (const ReadingItem *item : items)
     {
-        file << "Item " << itemNumber << ": " << it.getData()->displayName() << "\n";
-        it.getData()->print(file);
+        file << "Item " << itemNumber++ << ": ";
+        item->writeDisplayName(file);
+        file << "\n";
+        item->print(file);
         file << "\n";
     }
 
@@ -495,12 +909,11 @@ void Manager::run()
             saveToFile();
             break;
         case 6:
-            sortByTitle();
-            std::cout << "\nLibrary sorted by title.\n";
+            sortLibraryUI();
             break;
         case 7:
         {
-            std::string title = readLine("Enter title to search: ");
+            std::string title = readLine("Enter a title or the start of one: ");
             int seqIndex = sequentialSearchByTitle(title);
             if (seqIndex != -1)
             {
@@ -509,19 +922,49 @@ void Manager::run()
             else
             {
                 std::cout << "Not found via Sequential Search.\n";
+                std::vector<ReadingItem *> suggestions = suggestTitles(title);
+                if (!suggestions.empty())
+                {
+                    std::cout << "Did you mean:\n";
+                    for (std::size_t i = 0; i < suggestions.size() && i < 5; i++)
+                    {
+                        std::cout << "  ";
+                        suggestions[i]->writeDisplayName(std::cout);
+                        std::cout << "\n";
+                    }
+                }
             }
 
-            sortByTitle();
             int binIndex = binarySearchByTitle(title);
             if (binIndex != -1)
             {
                 std::cout << "Found via Binary Search at index " << binIndex
-                          << " after sorting by title.\n";
+                          << " in title order.\n";
             }
             else
             {
                 std::cout << "Not found via Binary Search.\n";
             }
+
+            std::vector<ReadingItem *> prefixMatches = searchByTitlePrefix(title);
+            std::cout << prefixMatches.size() << " title(s) start with \"" << title << "\"";
+            std::cout << (prefixMatches.empty() ? ".\n" : ":\n");
+            for (const ReadingItem *item : prefixMatches)
+            {
+                std::cout << "  ";
+                item->writeDisplayName(std::cout);
+                std::cout << "\n";
+            }
+
+            std::vector<ReadingItem *> fragmentMatches = searchByTitleFragment(title);
+            std::cout << fragmentMatches.size() << " title(s) contain \"" << title << "\"";
+            std::cout << (fragmentMatches.empty() ? ".\n" : ":\n");
+            for (const ReadingItem *item : fragmentMatches)
+            {
+                std::cout << "  ";
+                item->writeDisplayName(std::cout);
+                std::cout << "\n";
+            }
             break;
         }
         case 8:
@@ -0,0 +1,106 @@
+#include "common/collation.h"
+
+static bool isAscii(std::string_view text)
+{
+    for (char character : text)
+    {
+        if (static_cast<unsigned char>(character) >= 0x80)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void foldAscii(std::string &text)
+{
+    for (char &character : text)
+    {
+        if (character >= 'A' && character <= 'Z')
+        {
+            character = static_cast<char>(character - 'A' + 'a');
+        }
+    }
+}
+
+// UTF-8 Latin-1 capitals are 0xC3 0x80 to 0xC3 0x9E (except 0x97, the
+// multiplication sign); the lower-case letter is 0x20 higher in the second byte.
+static void foldLatin1(std::string &text)
+{
+    for (std::size_t i = 0; i < text.size(); i++)
+    {
+        const unsigned char character = static_cast<unsigned char>(text[i]);
+        if (character >= 'A' && character <= 'Z')
+        {
+            text[i] = static_cast<char>(character - 'A' + 'a');
+        }
+        else if (character == 0xC3 && i + 1 < text.size())
+        {
+            const unsigned char next = static_cast<unsigned char>(text[i + 1]);
+            if (next >= 0x80 && next <= 0x9E && next != 0x97)
+            {
+                text[i + 1] = static_cast<char>(next + 0x20);
+            }
+
+            i++;
+        }
+    }
+}
+
+std::string foldTitle(std::string_view text)
+{
+    std::string folded;
+    foldTitleInto(text, folded);
+    return folded;
+}
+
+void foldTitleInto(std::string_view text, std::string &folded)
+{
+    folded.assign(text.data(), text.size());
+    if (isAscii(text))
+    {
+        foldAscii(folded);
+    }
+    else
+    {
+        foldLatin1(folded);
+    }
+}
+
+// Length of a leading article and the spaces after it, or 0. A title that is
+// only an article ("A", "The ") keeps it, so no key becomes empty.
+static std::size_t leadingArticleLength(const std::string &folded)
+{
+    for (std::string_view article : {std::string_view("the "), std::string_view("an "), std::string_view("a ")})
+    {
+        if (folded.compare(0, article.size(), article) == 0)
+        {
+            std::size_t length = article.size();
+            while (length < folded.size() && folded[length] == ' ')
+            {
+                length++;
+            }
+
+            return length < folded.size() ? length : 0;
+        }
+    }
+
+    return 0;
+}
+
+CollationKey::CollationKey()
+    : articleLength(0) {}
+
+CollationKey::CollationKey(const std::string &title)
+    : folded(foldTitle(title)), articleLength(leadingArticleLength(folded)) {}
+
+const std::string &CollationKey::full() const
+{
+    return folded;
+}
+
+std::string_view CollationKey::withoutArticle() const
+{
+    return std::string_view(folded).substr(articleLength);
+}
@@ -0,0 +1,77 @@
+#include "common/name_pool.h"
+
+#include "common/container_exception.h"
+
+NamePool::NamePool()
+    : nameCount(0), nameBytes(0)
+{
+    for (std::atomic<std::string *> &block : blocks)
+    {
+        block.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+NamePool::~NamePool()
+{
+    for (std::atomic<std::string *> &block : blocks)
+    {
+        delete[] block.load(std::memory_order_relaxed);
+    }
+}
+
+NamePool &NamePool::global()
+{
+    static NamePool pool;
+    return pool;
+}
+
+NamePool::Symbol NamePool::intern(std::string_view name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = symbols.find(name);
+    if (it != symbols.end())
+    {
+        return it->second;
+    }
+
+    const Symbol symbol = nameCount;
+    const int blockIndex = static_cast<int>(symbol >> BLOCK_BITS);
+    if (blockIndex >= MAX_BLOCKS)
+    {
+        throw ContainerException("The name pool is full.");
+    }
+
+    std::string *block = blocks[blockIndex].load(std::memory_order_relaxed);
+    if (block == nullptr)
+    {
+        block = new std::string[BLOCK_SIZE];
+        blocks[blockIndex].store(block, std::memory_order_release);
+    }
+
+    std::string &stored = block[symbol & (BLOCK_SIZE - 1)];
+    stored.assign(name.data(), name.size());
+    symbols.emplace(std::string_view(stored), symbol);
+    nameCount++;
+    nameBytes += stored.size();
+    return symbol;
+}
+
+std::string_view NamePool::view(Symbol symbol) const
+{
+    // A symbol reaches a reader only after intern returned it, so its block is
+    // already published and its string is no longer written.
+    const std::string *block = blocks[symbol >> BLOCK_BITS].load(std::memory_order_acquire);
+    return block[symbol & (BLOCK_SIZE - 1)];
+}
+
+int NamePool::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<int>(nameCount);
+}
+
+std::size_t NamePool::storedBytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return nameBytes;
+}
@@ -3,25 +3,43 @@
 #include <iomanip>
 
 AudioBook::AudioBook()
-    : ReadingItem(), narrator("Unknown"), price() {}
+    : ReadingItem(), narrator(NamePool::global().intern("Unknown")), price() {}
 
 AudioBook::AudioBook(const std::string &title, int pages, double hours, Difficulty difficulty,
                      const std::string &narrator, const PriceInfo &price)
-    : ReadingItem(title, pages, hours, difficulty), narrator(narrator), price(price) {}
+    : ReadingItem(title, pages, hours, difficulty), narrator(NamePool::global().intern(narrator)), price(price) {}
+
+AudioBook &AudioBook::operator=(const AudioBook &other)
+{
+    if (this != &other)
+    {
+        // The base assignment tells the observers about the title and base
+        // fields; setPrice does the same for the price.
+        ReadingItem::operator=(other);
+        narrator = other.narrator;
+        invalidateDisplayName();
+        setPrice(other.price);
+    }
+
+    return *this;
+}
 
 void AudioBook::setNarrator(const std::string &narrator)
 {
-    this->narrator = narrator;
+    this->narrator = NamePool::global().intern(narrator);
+    invalidateDisplayName();
 }
 
-std::string AudioBook::getNarrator() const
+std::string_view AudioBook::getNarrator() const
 {
-    return narrator;
+    return NamePool::global().view(narrator);
 }
 
 void AudioBook::setPrice(const PriceInfo &price)
 {
+    notifyFieldsChanging();
     this->price = price;
+    notifyFieldsChanged();
 }
 
 const PriceInfo &AudioBook::getPrice() const
@@ -29,23 +47,32 @@ const PriceInfo &AudioBook::getPrice() const
     return price;
 }
 
-std::string AudioBook::displayName() const
+ReadingItem *AudioBook::clone() const
+{
+    return new AudioBook(*this);
+}
+
+void AudioBook::appendDisplayName(std::string &buffer) const
 {
-    return title + " (narrated by " + narrator + ")";
+    buffer.append(title).append(" (narrated by ").append(getNarrator()).push_back(')');
 }
 
 void AudioBook::toStream(std::ostream &os) const
 {
-    os << "AudioBook: " << displayName()
-       << " | pages: " << pages
+    os << "AudioBook: ";
+    writeDisplayName(os);
+    os << " | pages: " << pages
        << " | hours: " << std::fixed << std::setprecision(1) << hours
        << " | difficulty: " << difficultyToString(difficulty)
-       << " | cost: " << price.formattedCost();
+       << " | cost: ";
+    price.writeCost(os);
 }
 
 void AudioBook::print(std::ostream &os) const
 {
     ReadingItem::print(os);
-    os << "Narrator: " << narrator << "\n";
-    os << "Cost: " << price.formattedCost() << "\n";
+    os << "Narrator: " << getNarrator() << "\n";
+    os << "Cost: ";
+    price.writeCost(os);
+    os << "\n";
 }
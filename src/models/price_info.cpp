@@ -1,7 +1,8 @@
 #include "models/price_info.h"
 
-#include <iomanip>
-#include <sstream>
+#include <cstdio>
+#include <ostream>
+#include <string_view>
 
 PriceInfo::PriceInfo()
     : cost(0.0), includedWithSubscription(false) {}
@@ -34,14 +35,44 @@ bool PriceInfo::isFree() const
     return cost <= 0.0 || includedWithSubscription;
 }
 
-std::string PriceInfo::formattedCost() const
+// Formats the cost as "Free" or "$12.34" into a stack buffer. %.2f prints every
+// integer digit, so a cost too wide for the buffer is formatted again into
+// overflow, sized from the length the first snprintf reported.
+static std::string_view formatCost(const PriceInfo &price, char (&buffer)[48], std::string &overflow)
 {
-    if (isFree())
+    if (price.isFree())
     {
         return "Free";
     }
 
-    std::ostringstream output;
-    output << "$" << std::fixed << std::setprecision(2) << cost;
-    return output.str();
+    const int length = std::snprintf(buffer, sizeof buffer, "$%.2f", price.getCost());
+    if (length < 0)
+    {
+        return std::string_view();
+    }
+
+    if (length < static_cast<int>(sizeof buffer))
+    {
+        return std::string_view(buffer, static_cast<std::size_t>(length));
+    }
+
+    overflow.resize(static_cast<std::size_t>(length) + 1);
+    std::snprintf(&overflow[0], overflow.size(), "$%.2f", price.getCost());
+    overflow.resize(static_cast<std::size_t>(length));
+    return overflow;
+}
+
+std::string PriceInfo::formattedCost() const
+{
+    char buffer[48];
+    std::string overflow;
+    return std::string(formatCost(*this, buffer, overflow));
+}
+
+void PriceInfo::writeCost(std::ostream &os) const
+{
+    char buffer[48];
+    std::string overflow;
+    const std::string_view cost = formatCost(*this, buffer, overflow);
+    os.write(cost.data(), static_cast<std::streamsize>(cost.size()));
 }
@@ -3,25 +3,43 @@
 #include <iomanip>
 
 PrintBook::PrintBook()
-    : ReadingItem(), author("Unknown"), price() {}
+    : ReadingItem(), author(NamePool::global().intern("Unknown")), price() {}
 
 PrintBook::PrintBook(const std::string &title, int pages, double hours, Difficulty difficulty,
                      const std::string &author, const PriceInfo &price)
-    : ReadingItem(title, pages, hours, difficulty), author(author), price(price) {}
+    : ReadingItem(title, pages, hours, difficulty), author(NamePool::global().intern(author)), price(price) {}
+
+PrintBook &PrintBook::operator=(const PrintBook &other)
+{
+    if (this != &other)
+    {
+        // The base assignment tells the observers about the title and base
+        // fields; setPrice does the same for the price.
+        ReadingItem::operator=(other);
+        author = other.author;
+        invalidateDisplayName();
+        setPrice(other.price);
+    }
+
+    return *this;
+}
 
 void PrintBook::setAuthor(const std::string &author)
 {
-    this->author = author;
+    this->author = NamePool::global().intern(author);
+    invalidateDisplayName();
 }
 
-std::string PrintBook::getAuthor() const
+std::string_view PrintBook::getAuthor() const
 {
-    return author;
+    return NamePool::global().view(author);
 }
 
 void PrintBook::setPrice(const PriceInfo &price)
 {
+    notifyFieldsChanging();
     this->price = price;
+    notifyFieldsChanged();
 }
 
 const PriceInfo &PrintBook::getPrice() const
@@ -31,26 +49,36 @@ const PriceInfo &PrintBook::getPrice() const
 
 bool PrintBook::operator==(const PrintBook &other) const
 {
-    return title == other.title && author == other.author;
+    // Authors are interned, so comparing them compares two symbols.
+    return author == other.author && title == other.title;
+}
+
+ReadingItem *PrintBook::clone() const
+{
+    return new PrintBook(*this);
 }
 
-std::string PrintBook::displayName() const
+void PrintBook::appendDisplayName(std::string &buffer) const
 {
-    return title + " by " + author;
+    buffer.append(title).append(" by ").append(getAuthor());
 }
 
 void PrintBook::toStream(std::ostream &os) const
 {
-    os << "PrintBook: " << displayName()
-       << " | pages: " << pages
+    os << "PrintBook: ";
+    writeDisplayName(os);
+    os << " | pages: " << pages
        << " | hours: " << std::fixed << std::setprecision(1) << hours
        << " | difficulty: " << difficultyToString(difficulty)
-       << " | cost: " << price.formattedCost();
+       << " | cost: ";
+    price.writeCost(os);
 }
 
 void PrintBook::print(std::ostream &os) const
 {
     ReadingItem::print(os);
-    os << "Author: " << author << "\n";
-    os << "Cost: " << price.formattedCost() << "\n";
+    os << "Author: " << getAuthor() << "\n";
+    os << "Cost: ";
+    price.writeCost(os);
+    os << "\n";
 }
@@ -1,28 +1,105 @@
 #include "models/reading_item.h"
 
 #include <iomanip>
+#include <mutex>
+
+#include "common/container_exception.h"
 
 ReadingItem::ReadingItem()
-    : title("Untitled"), pages(0), difficulty(EASY), hours(0.0) {}
+    : collationKey("Untitled"), displayNameCached(false), title("Untitled"), pages(0), difficulty(EASY), hours(0.0) {}
 
 ReadingItem::ReadingItem(const std::string &title, int pages, double hours, Difficulty difficulty)
-    : title(title), pages(pages), difficulty(difficulty), hours(hours) {}
+    : collationKey(title), displayNameCached(false), title(title), pages(pages), difficulty(difficulty), hours(hours) {}
+
+ReadingItem::ReadingItem(const ReadingItem &other)
+    : collationKey(other.collationKey), displayNameCached(false), title(other.title), pages(other.pages),
+      difficulty(other.difficulty), hours(other.hours) {}
+
+ReadingItem::~ReadingItem()
+{
+    for (ReadingItemObserverHook &hook : observers)
+    {
+        if (hook.observer != nullptr)
+        {
+            hook.observer->itemDestroyed(*this);
+        }
+    }
+}
+
+ReadingItem &ReadingItem::operator=(const ReadingItem &other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
 
-ReadingItem::~ReadingItem() = default;
+    if (other.title != title)
+    {
+        assignTitle(other.title, other.collationKey);
+    }
+
+    notifyFieldsChanging();
+    pages = other.pages;
+    hours = other.hours;
+    difficulty = other.difficulty;
+    invalidateDisplayName();
+    notifyFieldsChanged();
+    return *this;
+}
 
 void ReadingItem::setTitle(const std::string &title)
 {
+    if (title == this->title)
+    {
+        return;
+    }
+
+    assignTitle(title, CollationKey(title));
+}
+
+void ReadingItem::assignTitle(const std::string &title, const CollationKey &key)
+{
+    // The container goes first, so it can refuse the title before anyone re-keys.
+    for (ReadingItemObserverHook &hook : observers)
+    {
+        if (hook.observer != nullptr)
+        {
+            hook.observer->titleChanging(*this, title);
+        }
+    }
+
     this->title = title;
+    collationKey = key;
+    invalidateDisplayName();
+    for (ReadingItemObserverHook &hook : observers)
+    {
+        if (hook.observer != nullptr)
+        {
+            hook.observer->titleChanged(*this);
+        }
+    }
+}
+
+const std::string &ReadingItem::getTitle() const
+{
+    return title;
 }
 
-std::string ReadingItem::getTitle() const
+std::string_view ReadingItem::titleView() const
 {
     return title;
 }
 
+const CollationKey &ReadingItem::getCollationKey() const
+{
+    return collationKey;
+}
+
 void ReadingItem::setPages(int pages)
 {
+    notifyFieldsChanging();
     this->pages = pages;
+    notifyFieldsChanged();
 }
 
 int ReadingItem::getPages() const
@@ -32,7 +109,9 @@ int ReadingItem::getPages() const
 
 void ReadingItem::setHours(double hours)
 {
+    notifyFieldsChanging();
     this->hours = hours;
+    notifyFieldsChanged();
 }
 
 double ReadingItem::getHours() const
@@ -42,7 +121,9 @@ double ReadingItem::getHours() const
 
 void ReadingItem::setDifficulty(Difficulty difficulty)
 {
+    notifyFieldsChanging();
     this->difficulty = difficulty;
+    notifyFieldsChanged();
 }
 
 Difficulty ReadingItem::getDifficulty() const
@@ -50,10 +131,114 @@ Difficulty ReadingItem::getDifficulty() const
     return difficulty;
 }
 
+void ReadingItem::attachObserver(ObserverRole role, ReadingItemObserver *observer, int slot)
+{
+    ReadingItemObserverHook &hook = observers[role];
+    if (hook.observer != nullptr && hook.observer != observer)
+    {
+        throw ContainerException(role == CONTAINER_OBSERVER ? "Item is already in a container."
+                                                            : "Item is already mirrored by another store.");
+    }
+
+    hook.observer = observer;
+    hook.slot = slot;
+}
+
+void ReadingItem::detachObserver(ObserverRole role)
+{
+    observers[role].observer = nullptr;
+    observers[role].slot = -1;
+}
+
+ReadingItemObserver *ReadingItem::getObserver(ObserverRole role) const
+{
+    return observers[role].observer;
+}
+
+int ReadingItem::getObserverSlot(ObserverRole role) const
+{
+    return observers[role].slot;
+}
+
+void ReadingItem::setObserverSlot(ObserverRole role, int slot)
+{
+    observers[role].slot = slot;
+}
+
+void ReadingItem::notifyFieldsChanging()
+{
+    for (ReadingItemObserverHook &hook : observers)
+    {
+        if (hook.observer != nullptr)
+        {
+            hook.observer->fieldsChanging(*this);
+        }
+    }
+}
+
+void ReadingItem::notifyFieldsChanged()
+{
+    for (ReadingItemObserverHook &hook : observers)
+    {
+        if (hook.observer != nullptr)
+        {
+            hook.observer->fieldsChanged(*this);
+        }
+    }
+}
+
+// One lock for every item: it is only taken to fill an empty cache, which
+// happens once per item between changes, so contention stays rare.
+static std::mutex &displayNameMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+void ReadingItem::invalidateDisplayName()
+{
+    displayNameCached.store(false, std::memory_order_release);
+}
+
+// Per-thread buffer that display names are rendered into before being cached or
+// written out, so neither path allocates once it has grown to fit.
+static std::string &displayNameScratch()
+{
+    static thread_local std::string scratch;
+    scratch.clear();
+    return scratch;
+}
+
+const std::string &ReadingItem::displayName() const
+{
+    if (!displayNameCached.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(displayNameMutex());
+        if (!displayNameCached.load(std::memory_order_relaxed))
+        {
+            // Render into the scratch buffer first, so the cache is allocated once
+            // at its final size instead of growing with each appended part.
+            std::string &scratch = displayNameScratch();
+            appendDisplayName(scratch);
+            displayNameCache.assign(scratch);
+            displayNameCached.store(true, std::memory_order_release);
+        }
+    }
+
+    return displayNameCache;
+}
+
+void ReadingItem::writeDisplayName(std::ostream &os) const
+{
+    std::string &scratch = displayNameScratch();
+    appendDisplayName(scratch);
+    os << scratch;
+}
+
 void ReadingItem::toStream(std::ostream &os) const
 {
-    os << displayName()
-       << " | pages: " << pages
+    writeDisplayName(os);
+    os << " | pages: " << pages
        << " | hours: " << std::fixed << std::setprecision(1) << hours
        << " | difficulty: " << difficultyToString(difficulty);
 }
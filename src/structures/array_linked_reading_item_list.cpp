@@ -0,0 +1,288 @@
+#include "structures/array_linked_reading_item_list.h"
+
+ArrayLinkedReadingItemListIterator::ArrayLinkedReadingItemListIterator(const ArrayLinkedReadingItemList *list, int slot)
+    : list(list), slot(slot) {}
+
+bool ArrayLinkedReadingItemListIterator::isValid() const
+{
+    return slot != -1;
+}
+
+void ArrayLinkedReadingItemListIterator::next()
+{
+    if (slot != -1)
+    {
+        slot = list->links[slot].next;
+    }
+}
+
+ReadingItem *ArrayLinkedReadingItemListIterator::getData() const
+{
+    if (!isValid())
+    {
+        throw ContainerException("Iterator is out of range.");
+    }
+
+    return list->links[slot].item;
+}
+
+ArrayLinkedReadingItemList::ArrayLinkedReadingItemList()
+    : head(-1), tail(-1), firstFree(-1), count(0) {}
+
+ArrayLinkedReadingItemList::~ArrayLinkedReadingItemList()
+{
+    clear();
+}
+
+bool ArrayLinkedReadingItemList::isEmpty() const
+{
+    return count == 0;
+}
+
+int ArrayLinkedReadingItemList::size() const
+{
+    return count;
+}
+
+bool ArrayLinkedReadingItemList::contains(const ReadingItem *item) const
+{
+    return item != nullptr && item->getObserver(CONTAINER_OBSERVER) == this;
+}
+
+ArrayLinkedReadingItemListIterator ArrayLinkedReadingItemList::begin() const
+{
+    return ArrayLinkedReadingItemListIterator(this, head);
+}
+
+void ArrayLinkedReadingItemList::insertFront(ReadingItem *item)
+{
+    const int slot = acquireSlot(item);
+    links[slot].prev = -1;
+    links[slot].next = head;
+    if (head == -1)
+    {
+        tail = slot;
+    }
+    else
+    {
+        links[head].prev = slot;
+    }
+
+    head = slot;
+    count++;
+}
+
+void ArrayLinkedReadingItemList::insertBack(ReadingItem *item)
+{
+    const int slot = acquireSlot(item);
+    links[slot].next = -1;
+    links[slot].prev = tail;
+    if (tail == -1)
+    {
+        head = slot;
+    }
+    else
+    {
+        links[tail].next = slot;
+    }
+
+    tail = slot;
+    count++;
+}
+
+bool ArrayLinkedReadingItemList::removeAt(int index)
+{
+    const int slot = slotAt(index);
+    return slot != -1 && remove(links[slot].item);
+}
+
+bool ArrayLinkedReadingItemList::remove(ReadingItem *item)
+{
+    if (!contains(item))
+    {
+        return false;
+    }
+
+    unlink(item->getObserverSlot(CONTAINER_OBSERVER));
+    item->detachObserver(CONTAINER_OBSERVER);
+    delete item;
+    return true;
+}
+
+bool ArrayLinkedReadingItemList::deleteByTitle(std::string_view title)
+{
+    return remove(searchByTitle(title));
+}
+
+ReadingItem *ArrayLinkedReadingItemList::searchByTitle(std::string_view title) const
+{
+    for (int slot = head; slot != -1; slot = links[slot].next)
+    {
+        if (links[slot].item->titleView() == title)
+        {
+            return links[slot].item;
+        }
+    }
+
+    return nullptr;
+}
+
+int ArrayLinkedReadingItemList::findByTitle(std::string_view title) const
+{
+    int index = 0;
+    for (int slot = head; slot != -1; slot = links[slot].next, index++)
+    {
+        if (links[slot].item->titleView() == title)
+        {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+ReadingItem *ArrayLinkedReadingItemList::at(int index) const
+{
+    const int slot = slotAt(index);
+    if (slot == -1)
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    return links[slot].item;
+}
+
+void ArrayLinkedReadingItemList::traverse(std::ostream &os) const
+{
+    if (isEmpty())
+    {
+        os << "List is empty.\n";
+        return;
+    }
+
+    int nodeNumber = 1;
+    for (int slot = head; slot != -1; slot = links[slot].next, nodeNumber++)
+    {
+        os << "Node " << nodeNumber << ": ";
+        links[slot].item->writeDisplayName(os);
+        os << "\n";
+    }
+}
+
+void ArrayLinkedReadingItemList::clear()
+{
+    for (int slot = head; slot != -1; slot = links[slot].next)
+    {
+        links[slot].item->detachObserver(CONTAINER_OBSERVER);
+        delete links[slot].item;
+    }
+
+    links.clear();
+    head = -1;
+    tail = -1;
+    firstFree = -1;
+    count = 0;
+}
+
+// Takes a free slot (or a new one at the end of the array) and marks the item
+// as a member that knows its slot.
+int ArrayLinkedReadingItemList::acquireSlot(ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot insert a null item.");
+    }
+
+    // Any container observer, this list included, means the item is already
+    // linked somewhere; taking it again would link and later delete it twice.
+    if (item->getObserver(CONTAINER_OBSERVER) != nullptr)
+    {
+        throw ContainerException("Item is already in a list.");
+    }
+
+    const int slot = firstFree != -1 ? firstFree : static_cast<int>(links.size());
+    item->attachObserver(CONTAINER_OBSERVER, this, slot);
+
+    if (slot == firstFree)
+    {
+        firstFree = links[slot].next;
+        links[slot].item = item;
+    }
+    else
+    {
+        links.push_back(Link{item, -1, -1});
+    }
+
+    return slot;
+}
+
+int ArrayLinkedReadingItemList::slotAt(int index) const
+{
+    if (index < 0 || index >= count)
+    {
+        return -1;
+    }
+
+    // Walk from whichever end is closer.
+    int slot;
+    if (index < count / 2)
+    {
+        slot = head;
+        for (int i = 0; i < index; i++)
+        {
+            slot = links[slot].next;
+        }
+    }
+    else
+    {
+        slot = tail;
+        for (int i = count - 1; i > index; i--)
+        {
+            slot = links[slot].prev;
+        }
+    }
+
+    return slot;
+}
+
+void ArrayLinkedReadingItemList::unlink(int slot)
+{
+    Link &link = links[slot];
+    if (link.prev == -1)
+    {
+        head = link.next;
+    }
+    else
+    {
+        links[link.prev].next = link.next;
+    }
+
+    if (link.next == -1)
+    {
+        tail = link.prev;
+    }
+    else
+    {
+        links[link.next].prev = link.prev;
+    }
+
+    link.item = nullptr;
+    link.prev = -1;
+    link.next = firstFree;
+    firstFree = slot;
+    count--;
+}
+
+void ArrayLinkedReadingItemList::titleChanging(ReadingItem &, std::string_view) {}
+
+void ArrayLinkedReadingItemList::titleChanged(ReadingItem &) {}
+
+void ArrayLinkedReadingItemList::fieldsChanging(ReadingItem &) {}
+
+void ArrayLinkedReadingItemList::fieldsChanged(ReadingItem &) {}
+
+// The item was deleted while still in the list: free its slot.
+void ArrayLinkedReadingItemList::itemDestroyed(ReadingItem &item)
+{
+    unlink(item.getObserverSlot(CONTAINER_OBSERVER));
+}
@@ -0,0 +1,331 @@
+#include "structures/concurrent_reading_item_list.h"
+
+#include <algorithm>
+#include <limits>
+
+ConcurrentReadingItemNode::ConcurrentReadingItemNode(ReadingItem *data, ConcurrentReadingItemNode *next)
+    : data(data), next(next) {}
+
+ConcurrentReadingItemListIterator::ConcurrentReadingItemListIterator(ConcurrentReadingItemNode *start)
+    : current(start) {}
+
+bool ConcurrentReadingItemListIterator::isValid() const
+{
+    return current != nullptr;
+}
+
+void ConcurrentReadingItemListIterator::next()
+{
+    if (current != nullptr)
+    {
+        current = current->next.load(std::memory_order_acquire);
+    }
+}
+
+ReadingItem *ConcurrentReadingItemListIterator::getData() const
+{
+    if (!isValid())
+    {
+        throw ContainerException("Iterator is out of range.");
+    }
+
+    return current->data;
+}
+
+ReadingItem *ConcurrentReadingItemListIterator::operator*() const
+{
+    return current->data;
+}
+
+ConcurrentReadingItemListIterator &ConcurrentReadingItemListIterator::operator++()
+{
+    next();
+    return *this;
+}
+
+bool ConcurrentReadingItemListIterator::operator==(const ConcurrentReadingItemListIterator &other) const
+{
+    return current == other.current;
+}
+
+bool ConcurrentReadingItemListIterator::operator!=(const ConcurrentReadingItemListIterator &other) const
+{
+    return current != other.current;
+}
+
+ConcurrentReadingItemListSnapshot::ConcurrentReadingItemListSnapshot(const ConcurrentReadingItemList &list)
+    : list(list), slot(list.pinReader()) {}
+
+ConcurrentReadingItemListSnapshot::~ConcurrentReadingItemListSnapshot()
+{
+    slot.store(0);
+}
+
+ConcurrentReadingItemListIterator ConcurrentReadingItemListSnapshot::begin() const
+{
+    return ConcurrentReadingItemListIterator(list.head.load(std::memory_order_acquire));
+}
+
+ConcurrentReadingItemListIterator ConcurrentReadingItemListSnapshot::end() const
+{
+    return ConcurrentReadingItemListIterator();
+}
+
+void ConcurrentReadingItemListSnapshot::traverse(std::ostream &os) const
+{
+    ConcurrentReadingItemListIterator it = begin();
+    if (!it.isValid())
+    {
+        os << "List is empty.\n";
+        return;
+    }
+
+    int nodeNumber = 1;
+    for (; it.isValid(); it.next(), nodeNumber++)
+    {
+        os << "Node " << nodeNumber << ": ";
+        it.getData()->writeDisplayName(os);
+        os << "\n";
+    }
+}
+
+ConcurrentReadingItemList::ConcurrentReadingItemList()
+    : head(nullptr), tail(nullptr), count(0), globalEpoch(1)
+{
+    for (std::atomic<std::uint64_t> &readerEpoch : readerEpochs)
+    {
+        readerEpoch.store(0);
+    }
+}
+
+ConcurrentReadingItemList::~ConcurrentReadingItemList()
+{
+    ConcurrentReadingItemNode *current = head.load();
+    while (current != nullptr)
+    {
+        ConcurrentReadingItemNode *next = current->next.load();
+        delete current->data;
+        delete current;
+        current = next;
+    }
+
+    for (const RetiredNode &entry : retired)
+    {
+        delete entry.node->data;
+        delete entry.node;
+    }
+}
+
+bool ConcurrentReadingItemList::isEmpty() const
+{
+    return size() == 0;
+}
+
+int ConcurrentReadingItemList::size() const
+{
+    return count.load();
+}
+
+std::atomic<std::uint64_t> &ConcurrentReadingItemList::pinReader() const
+{
+    for (std::atomic<std::uint64_t> &readerEpoch : readerEpochs)
+    {
+        std::uint64_t free = 0;
+        std::uint64_t epoch = globalEpoch.load();
+        if (!readerEpoch.compare_exchange_strong(free, epoch))
+        {
+            continue;
+        }
+
+        // A writer may have advanced the epoch and scanned the slots between our
+        // load and the claim; re-pin until the published epoch is still current,
+        // so nothing retired before it can be reached through this snapshot.
+        for (std::uint64_t current = globalEpoch.load(); current != epoch; current = globalEpoch.load())
+        {
+            epoch = current;
+            readerEpoch.store(epoch);
+        }
+
+        return readerEpoch;
+    }
+
+    throw ContainerException("Too many concurrent readers.");
+}
+
+void ConcurrentReadingItemList::insertFront(ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot insert a null item.");
+    }
+
+    std::lock_guard<std::mutex> lock(writeMutex);
+    ConcurrentReadingItemNode *newNode =
+        new ConcurrentReadingItemNode(item, head.load(std::memory_order_relaxed));
+    if (tail == nullptr)
+    {
+        tail = newNode;
+    }
+
+    head.store(newNode, std::memory_order_release);
+    count++;
+}
+
+void ConcurrentReadingItemList::insertBack(ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot insert a null item.");
+    }
+
+    std::lock_guard<std::mutex> lock(writeMutex);
+    ConcurrentReadingItemNode *newNode = new ConcurrentReadingItemNode(item);
+    if (tail == nullptr)
+    {
+        head.store(newNode, std::memory_order_release);
+    }
+    else
+    {
+        tail->next.store(newNode, std::memory_order_release);
+    }
+
+    tail = newNode;
+    count++;
+}
+
+bool ConcurrentReadingItemList::removeAt(int index)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    if (index < 0 || index >= count.load())
+    {
+        return false;
+    }
+
+    ConcurrentReadingItemNode *previous = nullptr;
+    ConcurrentReadingItemNode *current = head.load(std::memory_order_relaxed);
+    for (int i = 0; i < index; i++)
+    {
+        previous = current;
+        current = current->next.load(std::memory_order_relaxed);
+    }
+
+    unlinkAfter(previous, current);
+    reclaimRetired();
+    return true;
+}
+
+bool ConcurrentReadingItemList::remove(ReadingItem *item)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    ConcurrentReadingItemNode *previous = nullptr;
+    for (ConcurrentReadingItemNode *current = head.load(std::memory_order_relaxed); current != nullptr;
+         previous = current, current = current->next.load(std::memory_order_relaxed))
+    {
+        if (current->data == item)
+        {
+            unlinkAfter(previous, current);
+            reclaimRetired();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ConcurrentReadingItemList::deleteByTitle(std::string_view title)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    ConcurrentReadingItemNode *previous = nullptr;
+    for (ConcurrentReadingItemNode *current = head.load(std::memory_order_relaxed); current != nullptr;
+         previous = current, current = current->next.load(std::memory_order_relaxed))
+    {
+        if (current->data->titleView() == title)
+        {
+            unlinkAfter(previous, current);
+            reclaimRetired();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ConcurrentReadingItemList::clear()
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    ConcurrentReadingItemNode *current = head.load(std::memory_order_relaxed);
+    head.store(nullptr, std::memory_order_release);
+    tail = nullptr;
+    count.store(0);
+
+    const std::uint64_t epoch = globalEpoch.fetch_add(1);
+    while (current != nullptr)
+    {
+        retired.push_back(RetiredNode{current, epoch});
+        current = current->next.load(std::memory_order_relaxed);
+    }
+
+    reclaimRetired();
+}
+
+int ConcurrentReadingItemList::reclaim()
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    return reclaimRetired();
+}
+
+int ConcurrentReadingItemList::getRetiredCount() const
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    return static_cast<int>(retired.size());
+}
+
+void ConcurrentReadingItemList::unlinkAfter(ConcurrentReadingItemNode *previous, ConcurrentReadingItemNode *node)
+{
+    // The removed node keeps its next link, so a reader standing on it can still
+    // walk on into the live list.
+    ConcurrentReadingItemNode *next = node->next.load(std::memory_order_relaxed);
+    if (previous == nullptr)
+    {
+        head.store(next, std::memory_order_release);
+    }
+    else
+    {
+        previous->next.store(next, std::memory_order_release);
+    }
+
+    if (node == tail)
+    {
+        tail = previous;
+    }
+
+    count--;
+
+    // Snapshots pinned after this increment cannot reach the node any more.
+    retired.push_back(RetiredNode{node, globalEpoch.fetch_add(1)});
+}
+
+int ConcurrentReadingItemList::reclaimRetired()
+{
+    std::uint64_t oldestPinned = std::numeric_limits<std::uint64_t>::max();
+    for (const std::atomic<std::uint64_t> &readerEpoch : readerEpochs)
+    {
+        const std::uint64_t epoch = readerEpoch.load();
+        if (epoch != 0)
+        {
+            oldestPinned = std::min(oldestPinned, epoch);
+        }
+    }
+
+    auto stillVisible = std::partition(retired.begin(), retired.end(),
+                                       [oldestPinned](const RetiredNode &entry) { return entry.epoch >= oldestPinned; });
+    const int freed = static_cast<int>(retired.end() - stillVisible);
+    for (auto it = stillVisible; it != retired.end(); ++it)
+    {
+        delete it->node->data;
+        delete it->node;
+    }
+
+    retired.erase(stillVisible, retired.end());
+    return freed;
+}
@@ -0,0 +1,228 @@
+#include "structures/partitioned_reading_item_store.h"
+
+PartitionedReadingItemStore::PartitionedReadingItemStore()
+    : nextBackSequence(0), nextFrontSequence(-1) {}
+
+bool PartitionedReadingItemStore::isEmpty() const
+{
+    return size() == 0;
+}
+
+int PartitionedReadingItemStore::size() const
+{
+    return countOf<PrintBook>() + countOf<AudioBook>();
+}
+
+void PartitionedReadingItemStore::insertBack(const PrintBook &book)
+{
+    insertInto(book, nextBackSequence++);
+}
+
+void PartitionedReadingItemStore::insertBack(const AudioBook &book)
+{
+    insertInto(book, nextBackSequence++);
+}
+
+void PartitionedReadingItemStore::insertFront(const PrintBook &book)
+{
+    insertInto(book, nextFrontSequence--);
+}
+
+void PartitionedReadingItemStore::insertFront(const AudioBook &book)
+{
+    insertInto(book, nextFrontSequence--);
+}
+
+void PartitionedReadingItemStore::insertCopy(const ReadingItem &item)
+{
+    if (const PrintBook *book = dynamic_cast<const PrintBook *>(&item))
+    {
+        insertBack(*book);
+    }
+    else if (const AudioBook *book = dynamic_cast<const AudioBook *>(&item))
+    {
+        insertBack(*book);
+    }
+    else
+    {
+        throw ContainerException("Only print books and audio books can be stored by type.");
+    }
+}
+
+bool PartitionedReadingItemStore::removeAt(int index)
+{
+    if (index < 0 || index >= size())
+    {
+        return false;
+    }
+
+    const std::pair<bool, int> position = locate(index);
+    if (position.first)
+    {
+        printBooks.books.erase(printBooks.books.begin() + position.second);
+        printBooks.sequences.erase(printBooks.sequences.begin() + position.second);
+    }
+    else
+    {
+        audioBooks.books.erase(audioBooks.books.begin() + position.second);
+        audioBooks.sequences.erase(audioBooks.sequences.begin() + position.second);
+    }
+
+    return true;
+}
+
+bool PartitionedReadingItemStore::deleteByTitle(std::string_view title)
+{
+    int index = findByTitle(title);
+    return index != -1 && removeAt(index);
+}
+
+int PartitionedReadingItemStore::findByTitle(std::string_view title) const
+{
+    int index = 0;
+    int found = -1;
+    visitInOrder(
+        [&title, &index, &found](const ReadingItem &item)
+        {
+            if (found == -1 && item.titleView() == title)
+            {
+                found = index;
+            }
+
+            index++;
+        });
+
+    return found;
+}
+
+const ReadingItem *PartitionedReadingItemStore::at(int index) const
+{
+    if (index < 0 || index >= size())
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    const std::pair<bool, int> position = locate(index);
+    if (position.first)
+    {
+        return &printBooks.books[position.second];
+    }
+
+    return &audioBooks.books[position.second];
+}
+
+int PartitionedReadingItemStore::getTotalPages() const
+{
+    int totalPages = 0;
+    for (const PrintBook &book : printBooks.books)
+    {
+        totalPages += book.getPages();
+    }
+
+    for (const AudioBook &book : audioBooks.books)
+    {
+        totalPages += book.getPages();
+    }
+
+    return totalPages;
+}
+
+double PartitionedReadingItemStore::getTotalHours() const
+{
+    double totalHours = 0.0;
+    for (const PrintBook &book : printBooks.books)
+    {
+        totalHours += book.getHours();
+    }
+
+    for (const AudioBook &book : audioBooks.books)
+    {
+        totalHours += book.getHours();
+    }
+
+    return totalHours;
+}
+
+void PartitionedReadingItemStore::traverse(std::ostream &os) const
+{
+    if (isEmpty())
+    {
+        os << "List is empty.\n";
+        return;
+    }
+
+    int nodeNumber = 1;
+    visitInOrder([&os, &nodeNumber](const auto &book)
+                 {
+                     os << "Node " << nodeNumber++ << ": ";
+                     book.writeDisplayName(os);
+                     os << "\n";
+                 });
+}
+
+void PartitionedReadingItemStore::printByType(std::ostream &os) const
+{
+    // One loop per concrete type, so each print call binds to a final override.
+    if (!printBooks.books.empty())
+    {
+        os << "--- Print books (" << countOf<PrintBook>() << ") ---\n";
+        for (const PrintBook &book : printBooks.books)
+        {
+            book.print(os);
+        }
+    }
+
+    if (!audioBooks.books.empty())
+    {
+        os << "--- Audio books (" << countOf<AudioBook>() << ") ---\n";
+        for (const AudioBook &book : audioBooks.books)
+        {
+            book.print(os);
+        }
+    }
+}
+
+void PartitionedReadingItemStore::clear()
+{
+    printBooks = Partition<PrintBook>();
+    audioBooks = Partition<AudioBook>();
+    nextBackSequence = 0;
+    nextFrontSequence = -1;
+}
+
+std::pair<bool, int> PartitionedReadingItemStore::locate(int index) const
+{
+    // The print book at offset p sits at global position p plus the number of
+    // audio books inserted before it. That position grows with p, so the first
+    // p whose position reaches index is found by binary search. If that print
+    // book is not at index, the item is the audio book with p print books ahead.
+    const std::vector<long long> &printSequences = printBooks.sequences;
+    const std::vector<long long> &audioSequences = audioBooks.sequences;
+    auto positionOf = [&](int p)
+    {
+        return p + static_cast<int>(std::lower_bound(audioSequences.begin(), audioSequences.end(), printSequences[p]) -
+                                    audioSequences.begin());
+    };
+
+    int low = 0;
+    int high = countOf<PrintBook>();
+    while (low < high)
+    {
+        const int middle = low + (high - low) / 2;
+        if (positionOf(middle) < index)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if (low < countOf<PrintBook>() && positionOf(low) == index)
+    {
+        return {true, low};
+    }
+
+    return {false, index - low};
+}
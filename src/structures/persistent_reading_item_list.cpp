@@ -0,0 +1,410 @@
+#include "structures/persistent_reading_item_list.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <queue>
+#include <utility>
+
+PersistentReadingItemListIterator::PersistentReadingItemListIterator(const PersistentListNode *root)
+{
+    pushLeftSpine(root);
+}
+
+void PersistentReadingItemListIterator::pushLeftSpine(const PersistentListNode *node)
+{
+    for (; node != nullptr; node = node->left.get())
+    {
+        pending.push_back(node);
+    }
+}
+
+bool PersistentReadingItemListIterator::isValid() const
+{
+    return !pending.empty();
+}
+
+void PersistentReadingItemListIterator::next()
+{
+    if (pending.empty())
+    {
+        return;
+    }
+
+    const PersistentListNode *current = pending.back();
+    pending.pop_back();
+    pushLeftSpine(current->right.get());
+}
+
+const ReadingItem *PersistentReadingItemListIterator::getData() const
+{
+    if (!isValid())
+    {
+        throw ContainerException("Iterator is out of range.");
+    }
+
+    return pending.back()->item.get();
+}
+
+PersistentReadingItemList::PersistentReadingItemList()
+    : root(nullptr) {}
+
+PersistentReadingItemList::PersistentReadingItemList(PersistentListNodePtr root)
+    : root(std::move(root)) {}
+
+PersistentReadingItemList PersistentReadingItemList::fromItems(
+    const std::vector<std::shared_ptr<const ReadingItem>> &items)
+{
+    for (const std::shared_ptr<const ReadingItem> &item : items)
+    {
+        if (item == nullptr)
+        {
+            throw ContainerException("Cannot insert a null item.");
+        }
+    }
+
+    return PersistentReadingItemList(build(items, 0, static_cast<int>(items.size())));
+}
+
+bool PersistentReadingItemList::isEmpty() const
+{
+    return root == nullptr;
+}
+
+int PersistentReadingItemList::size() const
+{
+    return sizeOf(root);
+}
+
+bool PersistentReadingItemList::sameVersionAs(const PersistentReadingItemList &other) const
+{
+    return root == other.root;
+}
+
+const ReadingItem *PersistentReadingItemList::at(int index) const
+{
+    return shareAt(index).get();
+}
+
+std::shared_ptr<const ReadingItem> PersistentReadingItemList::shareAt(int index) const
+{
+    if (index < 0 || index >= size())
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    const PersistentListNode *current = root.get();
+    while (true)
+    {
+        const int leftSize = sizeOf(current->left);
+        if (index < leftSize)
+        {
+            current = current->left.get();
+        }
+        else if (index > leftSize)
+        {
+            index -= leftSize + 1;
+            current = current->right.get();
+        }
+        else
+        {
+            return current->item;
+        }
+    }
+}
+
+std::vector<std::shared_ptr<const ReadingItem>> PersistentReadingItemList::toItems() const
+{
+    std::vector<std::shared_ptr<const ReadingItem>> items;
+    items.reserve(size());
+    appendItems(root, items);
+    return items;
+}
+
+PersistentReadingItemList PersistentReadingItemList::pushBack(std::shared_ptr<const ReadingItem> item) const
+{
+    return insertAt(size(), std::move(item));
+}
+
+PersistentReadingItemList PersistentReadingItemList::insertAt(int index, std::shared_ptr<const ReadingItem> item) const
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot insert a null item.");
+    }
+
+    if (index < 0 || index > size())
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    return PersistentReadingItemList(insertAt(root, index, std::move(item)));
+}
+
+PersistentReadingItemList PersistentReadingItemList::removeAt(int index) const
+{
+    if (index < 0 || index >= size())
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    return PersistentReadingItemList(removeAt(root, index));
+}
+
+PersistentReadingItemList PersistentReadingItemList::replaceAt(int index, std::shared_ptr<const ReadingItem> item) const
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot insert a null item.");
+    }
+
+    if (index < 0 || index >= size())
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    return PersistentReadingItemList(replaceAt(root, index, std::move(item)));
+}
+
+PersistentReadingItemListIterator PersistentReadingItemList::begin() const
+{
+    return PersistentReadingItemListIterator(root.get());
+}
+
+void PersistentReadingItemList::traverse(std::ostream &os) const
+{
+    if (isEmpty())
+    {
+        os << "List is empty.\n";
+        return;
+    }
+
+    int nodeNumber = 1;
+    for (PersistentReadingItemListIterator it = begin(); it.isValid(); it.next(), nodeNumber++)
+    {
+        os << "Node " << nodeNumber << ": ";
+        it.getData()->writeDisplayName(os);
+        os << "\n";
+    }
+}
+
+PersistentListDiff PersistentReadingItemList::diff(const PersistentReadingItemList &older,
+                                                   const PersistentReadingItemList &newer)
+{
+    // Walk both trees from the top, tallest nodes first. A child is always shorter
+    // than its parent, so by the time nodes of some height are popped every path
+    // to them has been expanded: a node shared by both versions is then queued
+    // once from each side, adjacent in the queue, and is dropped unexpanded.
+    struct Pending
+    {
+        const PersistentListNode *node;
+        bool fromNewer;
+
+        bool operator<(const Pending &other) const
+        {
+            if (node->height != other.node->height)
+            {
+                return node->height < other.node->height;
+            }
+
+            return std::less<const PersistentListNode *>()(node, other.node);
+        }
+    };
+
+    std::priority_queue<Pending> pending;
+    if (older.root != nullptr)
+    {
+        pending.push(Pending{older.root.get(), false});
+    }
+    if (newer.root != nullptr)
+    {
+        pending.push(Pending{newer.root.get(), true});
+    }
+
+    std::vector<std::shared_ptr<const ReadingItem>> onlyOlder;
+    std::vector<std::shared_ptr<const ReadingItem>> onlyNewer;
+    while (!pending.empty())
+    {
+        const Pending current = pending.top();
+        pending.pop();
+        if (!pending.empty() && pending.top().node == current.node)
+        {
+            pending.pop();
+            continue;
+        }
+
+        (current.fromNewer ? onlyNewer : onlyOlder).push_back(current.node->item);
+        for (const PersistentListNodePtr &child : {current.node->left, current.node->right})
+        {
+            if (child != nullptr)
+            {
+                pending.push(Pending{child.get(), current.fromNewer});
+            }
+        }
+    }
+
+    // Path copying rebuilds nodes around unchanged items, so an item can sit in an
+    // unshared node on both sides; only items left over after matching changed.
+    auto byAddress = [](const std::shared_ptr<const ReadingItem> &left, const std::shared_ptr<const ReadingItem> &right)
+    { return std::less<const ReadingItem *>()(left.get(), right.get()); };
+    std::sort(onlyOlder.begin(), onlyOlder.end(), byAddress);
+    std::sort(onlyNewer.begin(), onlyNewer.end(), byAddress);
+
+    PersistentListDiff result;
+    std::set_difference(onlyNewer.begin(), onlyNewer.end(), onlyOlder.begin(), onlyOlder.end(),
+                        std::back_inserter(result.added), byAddress);
+    std::set_difference(onlyOlder.begin(), onlyOlder.end(), onlyNewer.begin(), onlyNewer.end(),
+                        std::back_inserter(result.removed), byAddress);
+    return result;
+}
+
+int PersistentReadingItemList::sizeOf(const PersistentListNodePtr &node)
+{
+    return node == nullptr ? 0 : node->size;
+}
+
+int PersistentReadingItemList::heightOf(const PersistentListNodePtr &node)
+{
+    return node == nullptr ? 0 : node->height;
+}
+
+PersistentListNodePtr PersistentReadingItemList::makeNode(std::shared_ptr<const ReadingItem> item,
+                                                          PersistentListNodePtr left, PersistentListNodePtr right)
+{
+    const int size = sizeOf(left) + sizeOf(right) + 1;
+    const int height = std::max(heightOf(left), heightOf(right)) + 1;
+    return std::make_shared<const PersistentListNode>(
+        PersistentListNode{std::move(item), std::move(left), std::move(right), size, height});
+}
+
+PersistentListNodePtr PersistentReadingItemList::balance(std::shared_ptr<const ReadingItem> item,
+                                                         PersistentListNodePtr left, PersistentListNodePtr right)
+{
+    // One insert or removal changes a subtree height by at most one, so the two
+    // sides differ by at most two and one single or double rotation restores AVL.
+    if (heightOf(left) > heightOf(right) + 1)
+    {
+        if (heightOf(left->left) >= heightOf(left->right))
+        {
+            return makeNode(left->item, left->left, makeNode(std::move(item), left->right, std::move(right)));
+        }
+
+        const PersistentListNodePtr &pivot = left->right;
+        return makeNode(pivot->item, makeNode(left->item, left->left, pivot->left),
+                        makeNode(std::move(item), pivot->right, std::move(right)));
+    }
+
+    if (heightOf(right) > heightOf(left) + 1)
+    {
+        if (heightOf(right->right) >= heightOf(right->left))
+        {
+            return makeNode(right->item, makeNode(std::move(item), std::move(left), right->left), right->right);
+        }
+
+        const PersistentListNodePtr &pivot = right->left;
+        return makeNode(pivot->item, makeNode(std::move(item), std::move(left), pivot->left),
+                        makeNode(right->item, pivot->right, right->right));
+    }
+
+    return makeNode(std::move(item), std::move(left), std::move(right));
+}
+
+PersistentListNodePtr PersistentReadingItemList::build(const std::vector<std::shared_ptr<const ReadingItem>> &items,
+                                                       int begin, int end)
+{
+    if (begin >= end)
+    {
+        return nullptr;
+    }
+
+    const int middle = begin + (end - begin) / 2;
+    return makeNode(items[middle], build(items, begin, middle), build(items, middle + 1, end));
+}
+
+PersistentListNodePtr PersistentReadingItemList::insertAt(const PersistentListNodePtr &node, int index,
+                                                          std::shared_ptr<const ReadingItem> item)
+{
+    if (node == nullptr)
+    {
+        return makeNode(std::move(item), nullptr, nullptr);
+    }
+
+    const int leftSize = sizeOf(node->left);
+    if (index <= leftSize)
+    {
+        return balance(node->item, insertAt(node->left, index, std::move(item)), node->right);
+    }
+
+    return balance(node->item, node->left, insertAt(node->right, index - leftSize - 1, std::move(item)));
+}
+
+// Shape and sizes are unchanged, so the copied path needs no rebalancing.
+PersistentListNodePtr PersistentReadingItemList::replaceAt(const PersistentListNodePtr &node, int index,
+                                                           std::shared_ptr<const ReadingItem> item)
+{
+    const int leftSize = sizeOf(node->left);
+    if (index < leftSize)
+    {
+        return makeNode(node->item, replaceAt(node->left, index, std::move(item)), node->right);
+    }
+
+    if (index > leftSize)
+    {
+        return makeNode(node->item, node->left, replaceAt(node->right, index - leftSize - 1, std::move(item)));
+    }
+
+    return makeNode(std::move(item), node->left, node->right);
+}
+
+PersistentListNodePtr PersistentReadingItemList::removeAt(const PersistentListNodePtr &node, int index)
+{
+    const int leftSize = sizeOf(node->left);
+    if (index < leftSize)
+    {
+        return balance(node->item, removeAt(node->left, index), node->right);
+    }
+
+    if (index > leftSize)
+    {
+        return balance(node->item, node->left, removeAt(node->right, index - leftSize - 1));
+    }
+
+    if (node->left == nullptr)
+    {
+        return node->right;
+    }
+
+    if (node->right == nullptr)
+    {
+        return node->left;
+    }
+
+    std::shared_ptr<const ReadingItem> successor;
+    PersistentListNodePtr right = removeFirst(node->right, successor);
+    return balance(std::move(successor), node->left, std::move(right));
+}
+
+PersistentListNodePtr PersistentReadingItemList::removeFirst(const PersistentListNodePtr &node,
+                                                             std::shared_ptr<const ReadingItem> &first)
+{
+    if (node->left == nullptr)
+    {
+        first = node->item;
+        return node->right;
+    }
+
+    return balance(node->item, removeFirst(node->left, first), node->right);
+}
+
+void PersistentReadingItemList::appendItems(const PersistentListNodePtr &node,
+                                            std::vector<std::shared_ptr<const ReadingItem>> &out)
+{
+    if (node == nullptr)
+    {
+        return;
+    }
+
+    appendItems(node->left, out);
+    out.push_back(node->item);
+    appendItems(node->right, out);
+}
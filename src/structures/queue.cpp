@@ -1,20 +1,28 @@
 #include "structures/queue.h"
 
+#include <utility>
+
 Queue::Queue() : head(nullptr), tail(nullptr)
 {
 }
 
 Queue::~Queue()
 {
-    while (!isEmpty())
+    // Destroy the titles in place, then let the pool free every chunk at once.
+    QueueNode *current = head;
+    while (current != nullptr)
     {
-        dequeue();
+        QueueNode *next = current->next;
+        nodes.destroy(current);
+        current = next;
     }
+
+    nodes.releaseAll();
 }
 
 void Queue::enqueue(const std::string &value)
 {
-    QueueNode *node = new QueueNode{value, nullptr};
+    QueueNode *node = nodes.acquire(value, nullptr);
 
     if (tail == nullptr)
     {
@@ -28,6 +36,25 @@ void Queue::enqueue(const std::string &value)
     }
 }
 
+void Queue::enqueueAll(std::vector<std::string> values)
+{
+    nodes.reserve(static_cast<int>(values.size()));
+    for (std::string &value : values)
+    {
+        QueueNode *node = nodes.acquire(std::move(value), nullptr);
+        if (tail == nullptr)
+        {
+            head = node;
+        }
+        else
+        {
+            tail->next = node;
+        }
+
+        tail = node;
+    }
+}
+
 void Queue::dequeue()
 {
     if (isEmpty())
@@ -42,7 +69,7 @@ void Queue::dequeue()
         tail = nullptr;
     }
 
-    delete oldHead;
+    nodes.release(oldHead);
 }
 
 std::string Queue::front() const
@@ -59,3 +86,8 @@ bool Queue::isEmpty() const
 {
     return head == nullptr;
 }
+
+NodePoolStats Queue::getNodePoolStats() const
+{
+    return nodes.getStats();
+}
@@ -0,0 +1,234 @@
+#include "structures/reading_item_columns.h"
+
+#include <cstddef>
+
+#include "common/container_exception.h"
+#include "common/safe_divide.h"
+
+// Independent partial sums per pass of the aggregation loop; wide enough for
+// two 128-bit or one 256-bit register of doubles.
+static const std::size_t LANES = 4;
+
+int LibraryTotals::countFor(Difficulty difficulty) const
+{
+    return countByDifficulty[difficulty - EASY];
+}
+
+long long LibraryTotals::pagesFor(Difficulty difficulty) const
+{
+    return pagesByDifficulty[difficulty - EASY];
+}
+
+double LibraryTotals::hoursFor(Difficulty difficulty) const
+{
+    return hoursByDifficulty[difficulty - EASY];
+}
+
+double LibraryTotals::averagePages() const
+{
+    return safeDivide(static_cast<double>(totalPages), static_cast<double>(itemCount));
+}
+
+double LibraryTotals::averageHours() const
+{
+    return safeDivide(totalHours, static_cast<double>(itemCount));
+}
+
+double LibraryTotals::averageSpeed() const
+{
+    return safeDivide(static_cast<double>(totalPages), totalHours);
+}
+
+ReadingItemColumns::~ReadingItemColumns()
+{
+    clear();
+}
+
+void ReadingItemColumns::insert(ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot add a null item to the columns.");
+    }
+
+    if (item->getObserver(MIRROR_OBSERVER) != nullptr)
+    {
+        throw ContainerException("Item is already in a column store.");
+    }
+
+    const int row = size();
+    pages.push_back(0);
+    hours.push_back(0.0);
+    difficulties.push_back(0);
+    costs.push_back(0.0);
+    rowItems.push_back(item);
+
+    item->attachObserver(MIRROR_OBSERVER, this, row);
+    writeRow(row, item);
+}
+
+bool ReadingItemColumns::remove(ReadingItem *item)
+{
+    if (!contains(item))
+    {
+        return false;
+    }
+
+    // Fill the gap with the last row so every column stays dense.
+    const int row = item->getObserverSlot(MIRROR_OBSERVER);
+    const int last = size() - 1;
+    if (row != last)
+    {
+        pages[row] = pages[last];
+        hours[row] = hours[last];
+        difficulties[row] = difficulties[last];
+        costs[row] = costs[last];
+        rowItems[row] = rowItems[last];
+        rowItems[row]->setObserverSlot(MIRROR_OBSERVER, row);
+    }
+
+    pages.pop_back();
+    hours.pop_back();
+    difficulties.pop_back();
+    costs.pop_back();
+    rowItems.pop_back();
+
+    item->detachObserver(MIRROR_OBSERVER);
+    return true;
+}
+
+bool ReadingItemColumns::contains(const ReadingItem *item) const
+{
+    return item != nullptr && item->getObserver(MIRROR_OBSERVER) == this;
+}
+
+void ReadingItemColumns::reserve(int capacity)
+{
+    if (capacity <= 0)
+    {
+        return;
+    }
+
+    const std::size_t rows = static_cast<std::size_t>(capacity);
+    pages.reserve(rows);
+    hours.reserve(rows);
+    difficulties.reserve(rows);
+    costs.reserve(rows);
+    rowItems.reserve(rows);
+}
+
+int ReadingItemColumns::size() const
+{
+    return static_cast<int>(rowItems.size());
+}
+
+void ReadingItemColumns::clear()
+{
+    for (ReadingItem *item : rowItems)
+    {
+        item->detachObserver(MIRROR_OBSERVER);
+    }
+
+    pages.clear();
+    hours.clear();
+    difficulties.clear();
+    costs.clear();
+    rowItems.clear();
+}
+
+LibraryTotals ReadingItemColumns::aggregate() const
+{
+    const int levels = LibraryTotals::DIFFICULTY_LEVELS;
+    long long pageSums[LANES] = {};
+    double hourSums[LANES] = {};
+    double costSums[LANES] = {};
+    long long levelPages[LibraryTotals::DIFFICULTY_LEVELS][LANES] = {};
+    double levelHours[LibraryTotals::DIFFICULTY_LEVELS][LANES] = {};
+    int levelCounts[LibraryTotals::DIFFICULTY_LEVELS][LANES] = {};
+
+    const std::size_t rows = rowItems.size();
+    const std::size_t blocked = rows - rows % LANES;
+    const int *pageColumn = pages.data();
+    const double *hourColumn = hours.data();
+    const int *difficultyColumn = difficulties.data();
+    const double *costColumn = costs.data();
+
+    for (std::size_t base = 0; base < blocked; base += LANES)
+    {
+        for (std::size_t lane = 0; lane < LANES; lane++)
+        {
+            pageSums[lane] += pageColumn[base + lane];
+            hourSums[lane] += hourColumn[base + lane];
+            costSums[lane] += costColumn[base + lane];
+        }
+
+        // Multiplying by a 0/1 mask rather than branching on the difficulty keeps
+        // the loop free of unpredictable jumps and lets the lanes run in parallel.
+        for (int level = 0; level < levels; level++)
+        {
+            for (std::size_t lane = 0; lane < LANES; lane++)
+            {
+                const int matches = difficultyColumn[base + lane] - EASY == level;
+                levelPages[level][lane] += pageColumn[base + lane] * matches;
+                levelHours[level][lane] += hourColumn[base + lane] * matches;
+                levelCounts[level][lane] += matches;
+            }
+        }
+    }
+
+    for (std::size_t row = blocked; row < rows; row++)
+    {
+        pageSums[0] += pageColumn[row];
+        hourSums[0] += hourColumn[row];
+        costSums[0] += costColumn[row];
+        for (int level = 0; level < levels; level++)
+        {
+            const int matches = difficultyColumn[row] - EASY == level;
+            levelPages[level][0] += pageColumn[row] * matches;
+            levelHours[level][0] += hourColumn[row] * matches;
+            levelCounts[level][0] += matches;
+        }
+    }
+
+    LibraryTotals totals;
+    totals.itemCount = size();
+    for (std::size_t lane = 0; lane < LANES; lane++)
+    {
+        totals.totalPages += pageSums[lane];
+        totals.totalHours += hourSums[lane];
+        totals.totalCost += costSums[lane];
+        for (int level = 0; level < levels; level++)
+        {
+            totals.pagesByDifficulty[level] += levelPages[level][lane];
+            totals.hoursByDifficulty[level] += levelHours[level][lane];
+            totals.countByDifficulty[level] += levelCounts[level][lane];
+        }
+    }
+
+    return totals;
+}
+
+void ReadingItemColumns::writeRow(int row, const ReadingItem *item)
+{
+    pages[row] = item->getPages();
+    hours[row] = item->getHours();
+    difficulties[row] = item->getDifficulty();
+    costs[row] = item->getPrice().getCost();
+}
+
+// The title is not mirrored, so only field changes and deletions touch a row.
+void ReadingItemColumns::titleChanging(ReadingItem &, std::string_view) {}
+
+void ReadingItemColumns::titleChanged(ReadingItem &) {}
+
+void ReadingItemColumns::fieldsChanging(ReadingItem &) {}
+
+void ReadingItemColumns::fieldsChanged(ReadingItem &item)
+{
+    writeRow(item.getObserverSlot(MIRROR_OBSERVER), &item);
+}
+
+void ReadingItemColumns::itemDestroyed(ReadingItem &item)
+{
+    remove(&item);
+}
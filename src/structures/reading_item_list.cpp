@@ -1,191 +1,395 @@
 #include "structures/reading_item_list.h"
 
-ReadingItemNode::ReadingItemNode(ReadingItem *data, ReadingItemNode *next)
-    : data(data), next(next) {}
+#include <algorithm>
+#include <unordered_set>
 
-ReadingItemListIterator::ReadingItemListIterator(ReadingItemNode *start)
-    : current(start) {}
+ReadingItemNode::ReadingItemNode(ReadingItem *data, ReadingItemNode *next, ReadingItemNode *prev)
+    : data(data), next(next), prev(prev), nextSameTitle(nullptr), position(0), positionEntry(nullptr) {}
 
-bool ReadingItemListIterator::isValid() const
+ReadingItemList::ReadingItemList(DuplicateTitlePolicy duplicatePolicy, ListOrder listOrder)
+    : head(nullptr), tail(nullptr), count(0), duplicatePolicy(duplicatePolicy), listOrder(listOrder),
+      positionsValid(true), renamedNode(nullptr), itemObserver(nullptr) {}
+
+ReadingItemList::~ReadingItemList()
 {
-    return current != nullptr;
+    clear();
 }
 
-void ReadingItemListIterator::next()
+bool ReadingItemList::isEmpty() const
 {
-    if (current != nullptr)
-    {
-        current = current->next;
-    }
+    return count == 0;
 }
 
-ReadingItem *ReadingItemListIterator::getData() const
+int ReadingItemList::size() const
 {
-    if (!isValid())
-    {
-        throw ContainerException("Iterator is out of range.");
-    }
+    return count;
+}
+
+ReadingItemList::iterator ReadingItemList::begin() const
+{
+    return iterator(head, &tail);
+}
 
-    return current->data;
+ReadingItemList::iterator ReadingItemList::end() const
+{
+    return iterator(nullptr, &tail);
 }
 
-ReadingItemList::ReadingItemList()
-    : head(nullptr), tail(nullptr), count(0) {}
+ReadingItemList::const_iterator ReadingItemList::cbegin() const
+{
+    return begin();
+}
 
-ReadingItemList::~ReadingItemList()
+ReadingItemList::const_iterator ReadingItemList::cend() const
 {
-    clear();
+    return end();
 }
 
-bool ReadingItemList::isEmpty() const
+ReadingItemList::reverse_iterator ReadingItemList::rbegin() const
 {
-    return count == 0;
+    return reverse_iterator(tail, &head);
 }
 
-int ReadingItemList::size() const
+ReadingItemList::reverse_iterator ReadingItemList::rend() const
 {
-    return count;
+    return reverse_iterator(nullptr, &head);
+}
+
+DuplicateTitlePolicy ReadingItemList::getDuplicatePolicy() const
+{
+    return duplicatePolicy;
+}
+
+NodePoolStats ReadingItemList::getNodePoolStats() const
+{
+    return nodes.getStats();
+}
+
+void ReadingItemList::setItemObserver(ReadingItemObserver *observer)
+{
+    itemObserver = observer;
+}
+
+void ReadingItemList::setPositionIndex(bool enabled)
+{
+    if (!enabled)
+    {
+        positionIndex.reset();
+    }
+    else if (!positionIndex)
+    {
+        positionIndex = std::make_unique<IndexableSkipList<ReadingItemNode *>>();
+        rebuildPositionIndex();
+    }
+}
+
+bool ReadingItemList::hasPositionIndex() const
+{
+    return positionIndex != nullptr;
+}
+
+void ReadingItemList::setOrder(ListOrder listOrder)
+{
+    if (listOrder == TITLE_ORDER && this->listOrder != TITLE_ORDER)
+    {
+        restoreTitleOrder();
+    }
+
+    this->listOrder = listOrder;
 }
 
-ReadingItemListIterator ReadingItemList::begin() const
+ListOrder ReadingItemList::getOrder() const
 {
-    return ReadingItemListIterator(head);
+    return listOrder;
+}
+
+int ReadingItemList::titleRankOf(const ReadingItem *item) const
+{
+    return item == nullptr ? -1 : titleIndex.positionOf(item);
 }
 
 void ReadingItemList::insertFront(ReadingItem *item)
 {
-    if (item == nullptr)
+    if (listOrder == TITLE_ORDER)
     {
-        throw ContainerException("Cannot insert a null item.");
+        insertInTitleOrder(item);
+        return;
     }
 
-    head = new ReadingItemNode(item, head);
-    if (tail == nullptr)
+    checkInsertable(item);
+
+    ReadingItemNode *newNode = nodes.acquire(item, head);
+    if (isEmpty())
     {
-        tail = head;
+        tail = newNode;
+    }
+    else
+    {
+        newNode->position = head->position - 1;
+        head->prev = newNode;
     }
 
+    head = newNode;
+    indexPosition(newNode);
+    titleIndex.insert(item);
+    titleLookup.insertFront(newNode);
+    attach(item);
     count++;
 }
 
 void ReadingItemList::insertBack(ReadingItem *item)
 {
-    if (item == nullptr)
+    if (listOrder == TITLE_ORDER)
     {
-        throw ContainerException("Cannot insert a null item.");
+        insertInTitleOrder(item);
+        return;
     }
 
-    ReadingItemNode *newNode = new ReadingItemNode(item);
+    checkInsertable(item);
+
+    ReadingItemNode *newNode = nodes.acquire(item, nullptr, tail);
     if (isEmpty())
     {
         head = newNode;
-        tail = newNode;
     }
     else
     {
+        newNode->position = tail->position + 1;
         tail->next = newNode;
-        tail = newNode;
     }
 
+    tail = newNode;
+    indexPosition(newNode);
+    titleIndex.insert(item);
+    titleLookup.insertBack(newNode);
+    attach(item);
     count++;
 }
 
-bool ReadingItemList::removeAt(int index)
+void ReadingItemList::insertAt(int index, ReadingItem *item)
 {
-    if (index < 0 || index >= count)
+    if (index < 0 || index > count)
     {
-        return false;
+        throw ContainerException("Index out of range.");
+    }
+
+    if (listOrder == TITLE_ORDER)
+    {
+        insertInTitleOrder(item);
+        return;
+    }
+
+    checkInsertable(item);
+
+    ReadingItemNode *newNode = nodes.acquire(item);
+    ReadingItemNode *successor = nodeAt(index);
+    linkAfter(newNode, successor == nullptr ? tail : successor->prev);
+    titleIndex.insert(item);
+    chainInListOrder(newNode);
+    attach(item);
+    count++;
+}
+
+void ReadingItemList::insertRange(const std::vector<ReadingItem *> &batch)
+{
+    checkInsertable(batch);
+    if (batch.empty())
+    {
+        return;
     }
 
-    ReadingItemNode *nodeToDelete = head;
-    if (index == 0)
+    if (listOrder == TITLE_ORDER)
     {
-        head = head->next;
-        if (head == nullptr)
+        insertRangeInTitleOrder(batch);
+        return;
+    }
+
+    nodes.reserve(static_cast<int>(batch.size()));
+    for (ReadingItem *item : batch)
+    {
+        ReadingItemNode *newNode = nodes.acquire(item, nullptr, tail);
+        if (tail == nullptr)
+        {
+            head = newNode;
+        }
+        else
         {
-            tail = nullptr;
+            newNode->position = tail->position + 1;
+            tail->next = newNode;
         }
+
+        tail = newNode;
+        indexPosition(newNode);
+        titleLookup.insertBack(newNode);
+        attach(item);
+    }
+
+    titleIndex.insertBatch(batch);
+    count += static_cast<int>(batch.size());
+}
+
+void ReadingItemList::splice(ReadingItemList &other)
+{
+    if (&other == this || other.isEmpty())
+    {
+        return;
+    }
+
+    checkDistinctTitles(std::vector<ReadingItem *>(other.begin(), other.end()));
+
+    int position = isEmpty() ? 0 : tail->position + 1;
+    for (ReadingItemNode *current = other.head; current != nullptr; current = current->next)
+    {
+        current->position = position++;
+        current->positionEntry = positionIndex ? positionIndex->pushBack(current) : nullptr;
+        titleLookup.insertBack(current);
+        current->data->detachObserver(CONTAINER_OBSERVER);
+        attach(current->data);
+    }
+
+    if (isEmpty())
+    {
+        head = other.head;
     }
     else
     {
-        ReadingItemNode *previous = nodeAt(index - 1);
-        nodeToDelete = previous->next;
-        previous->next = nodeToDelete->next;
-        if (nodeToDelete == tail)
-        {
-            tail = previous;
-        }
+        tail->next = other.head;
+        other.head->prev = tail;
     }
 
-    delete nodeToDelete->data;
-    delete nodeToDelete;
-    count--;
+    tail = other.tail;
+    count += other.count;
+    nodes.adopt(other.nodes);
+    titleIndex.absorb(other.titleIndex);
+
+    other.titleLookup.clear();
+    if (other.positionIndex)
+    {
+        other.positionIndex->clear();
+    }
+
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.count = 0;
+    other.positionsValid = true;
+
+    if (listOrder == TITLE_ORDER)
+    {
+        restoreTitleOrder();
+    }
+}
+
+bool ReadingItemList::removeAt(int index)
+{
+    ReadingItemNode *node = nodeAt(index);
+    if (node == nullptr)
+    {
+        return false;
+    }
+
+    unlinkAndDelete(node);
     return true;
 }
 
-bool ReadingItemList::deleteByTitle(const std::string &title)
+ReadingItemNode *ReadingItemList::handleAt(int index) const
 {
-    if (isEmpty())
+    return nodeAt(index);
+}
+
+bool ReadingItemList::remove(ReadingItemNode *handle)
+{
+    // Only nodes the hash index knows for their item belong to this list.
+    if (handle == nullptr || titleLookup.nodeOf(handle->data) != handle)
     {
         return false;
     }
 
-    if (head->data->getTitle() == title)
+    unlinkAndDelete(handle);
+    return true;
+}
+
+bool ReadingItemList::remove(ReadingItem *item)
+{
+    ReadingItemNode *node = item == nullptr ? nullptr : titleLookup.nodeOf(item);
+    if (node == nullptr)
     {
-        return removeAt(0);
+        return false;
     }
 
-    ReadingItemNode *previous = head;
-    ReadingItemNode *current = head->next;
+    unlinkAndDelete(node);
+    return true;
+}
 
-    while (current != nullptr)
+bool ReadingItemList::extract(ReadingItem *item)
+{
+    ReadingItemNode *node = item == nullptr ? nullptr : titleLookup.nodeOf(item);
+    if (node == nullptr)
     {
-        if (current->data->getTitle() == title)
-        {
-            previous->next = current->next;
-            if (current == tail)
-            {
-                tail = previous;
-            }
-
-            delete current->data;
-            delete current;
-            count--;
-            return true;
-        }
+        return false;
+    }
 
-        previous = current;
-        current = current->next;
+    unlinkAndRelease(node);
+    return true;
+}
+
+bool ReadingItemList::deleteByTitle(std::string_view title)
+{
+    ReadingItemNode *node = titleLookup.find(title);
+    if (node == nullptr)
+    {
+        return false;
     }
 
-    return false;
+    unlinkAndDelete(node);
+    return true;
 }
 
-ReadingItem *ReadingItemList::searchByTitle(const std::string &title) const
+ReadingItem *ReadingItemList::searchByTitle(std::string_view title) const
 {
-    for (ReadingItemListIterator it = begin(); it.isValid(); it.next())
+    ReadingItemNode *node = titleLookup.find(title);
+    return node == nullptr ? nullptr : node->data;
+}
+
+int ReadingItemList::findByTitle(std::string_view title) const
+{
+    ReadingItemNode *node = titleLookup.find(title);
+    if (node == nullptr)
     {
-        if (it.getData()->getTitle() == title)
-        {
-            return it.getData();
-        }
+        return -1;
+    }
+
+    if (positionIndex)
+    {
+        return positionIndex->rankOf(node->positionEntry);
+    }
+
+    if (!positionsValid)
+    {
+        renumberPositions();
     }
 
-    return nullptr;
+    return node->position - head->position;
 }
 
-int ReadingItemList::findByTitle(const std::string &title) const
+int ReadingItemList::indexOf(const ReadingItem *item) const
 {
-    int index = 0;
-    for (ReadingItemListIterator it = begin(); it.isValid(); it.next(), index++)
+    if (item == nullptr || item->getObserver(CONTAINER_OBSERVER) != this)
     {
-        if (it.getData()->getTitle() == title)
-        {
-            return index;
-        }
+        return -1;
+    }
+
+    ReadingItemNode *node = titleLookup.nodeOf(item);
+    if (positionIndex)
+    {
+        return positionIndex->rankOf(node->positionEntry);
     }
 
-    return -1;
+    if (!positionsValid)
+    {
+        renumberPositions();
+    }
+
+    return node->position - head->position;
 }
 
 ReadingItem *ReadingItemList::at(int index) const
@@ -210,93 +414,132 @@ void ReadingItemList::traverse(std::ostream &os) const
     int nodeNumber = 1;
     for (ReadingItemListIterator it = begin(); it.isValid(); it.next(), nodeNumber++)
     {
-        os << "Node " << nodeNumber << ": " << it.getData()->displayName() << "\n";
+        os << "Node " << nodeNumber << ": ";
+        it.getData()->writeDisplayName(os);
+        os << "\n";
     }
 }
 
 void ReadingItemList::sortByTitle()
+{
+    // A list that keeps title order is already sorted.
+    if (listOrder != TITLE_ORDER)
+    {
+        mergeSortByTitle();
+    }
+}
+
+// Bottom-up merge sort: runs of width 1, 2, 4, ... are merged by relinking nodes,
+// so items never move between nodes and no extra array is needed. Taking from the
+// left run on ties keeps equal collation keys in their original order (stable).
+void ReadingItemList::mergeSortByTitle()
 {
     if (count < 2)
     {
         return;
     }
 
-    bool swapped;
-    do
+    ReadingItemNode sentinel(nullptr);
+    for (int width = 1; width < count; width *= 2)
     {
-        swapped = false;
-        ReadingItemNode *current = head;
+        ReadingItemNode *remaining = head;
+        ReadingItemNode *mergedTail = &sentinel;
 
-        while (current != nullptr && current->next != nullptr)
+        while (remaining != nullptr)
         {
-            if (current->data->getTitle() > current->next->data->getTitle())
-            {
-                ReadingItem *temp = current->data;
-                current->data = current->next->data;
-                current->next->data = temp;
-                swapped = true;
-            }
-
-            current = current->next;
+            ReadingItemNode *left = remaining;
+            ReadingItemNode *right = splitAfter(left, width);
+            remaining = splitAfter(right, width);
+            mergedTail = mergeByTitle(left, right, mergedTail);
         }
-    } while (swapped);
-}
 
-int ReadingItemList::binarySearchByTitle(const std::string &title) const
-{
-    if (isEmpty())
+        head = sentinel.next;
+        tail = mergedTail;
+    }
+
+    ReadingItemNode *previous = nullptr;
+    for (ReadingItemNode *current = head; current != nullptr; current = current->next)
     {
-        return -1;
+        current->prev = previous;
+        previous = current;
     }
 
-    ReadingItem **snapshot = new ReadingItem *[count];
-    int snapshotIndex = 0;
-    for (ReadingItemListIterator it = begin(); it.isValid(); it.next())
+    renumberPositions();
+    rebuildPositionIndex();
+}
+
+std::vector<ReadingItemNode *> ReadingItemList::collectNodes() const
+{
+    std::vector<ReadingItemNode *> order;
+    order.reserve(count);
+    for (ReadingItemNode *current = head; current != nullptr; current = current->next)
     {
-        snapshot[snapshotIndex++] = it.getData();
+        order.push_back(current);
     }
 
-    int result = -1;
-    int low = 0;
-    int high = count - 1;
+    return order;
+}
 
-    while (low <= high)
+void ReadingItemList::relinkInOrder(const std::vector<ReadingItemNode *> &order)
+{
+    ReadingItemNode *previous = nullptr;
+    int position = 0;
+    for (ReadingItemNode *current : order)
     {
-        int mid = low + (high - low) / 2;
-        if (snapshot[mid]->getTitle() == title)
+        current->prev = previous;
+        current->position = position++;
+        if (previous != nullptr)
         {
-            result = mid;
-            break;
+            previous->next = current;
         }
 
-        if (snapshot[mid]->getTitle() < title)
-        {
-            low = mid + 1;
-        }
-        else
-        {
-            high = mid - 1;
-        }
+        previous = current;
     }
 
-    delete[] snapshot;
-    return result;
+    head = order.front();
+    tail = order.back();
+    tail->next = nullptr;
+    positionsValid = true;
+    rebuildPositionIndex();
+
+    // Equal titles are chained in list order; a non-title sort can reorder them.
+    if (titleLookup.distinctTitleCount() < count)
+    {
+        titleLookup.restoreChainOrder(order);
+    }
+}
+
+int ReadingItemList::binarySearchByTitle(std::string_view title) const
+{
+    return titleIndex.find(title);
+}
+
+std::vector<ReadingItem *> ReadingItemList::searchByTitlePrefix(std::string_view prefix) const
+{
+    return titleIndex.itemsWithPrefix(prefix);
 }
 
 void ReadingItemList::clear()
 {
-    ReadingItemNode *current = head;
-    while (current != nullptr)
+    for (ReadingItemNode *current = head; current != nullptr; current = current->next)
     {
-        ReadingItemNode *next = current->next;
+        current->data->detachObserver(CONTAINER_OBSERVER);
         delete current->data;
-        delete current;
-        current = next;
     }
 
+    // Nodes are trivially destructible, so the pool frees their chunks in bulk.
+    nodes.releaseAll();
     head = nullptr;
     tail = nullptr;
     count = 0;
+    titleIndex.clear();
+    titleLookup.clear();
+    if (positionIndex)
+    {
+        positionIndex->clear();
+    }
+
+    positionsValid = true;
 }
 
 ReadingItemNode *ReadingItemList::nodeAt(int index) const
@@ -306,11 +549,445 @@ ReadingItemNode *ReadingItemList::nodeAt(int index) const
         return nullptr;
     }
 
-    ReadingItemNode *current = head;
-    for (int i = 0; i < index; i++)
+    if (positionIndex)
+    {
+        return positionIndex->nodeAt(index)->data;
+    }
+
+    // Walk from whichever end is closer.
+    ReadingItemNode *current;
+    if (index < count / 2)
+    {
+        current = head;
+        for (int i = 0; i < index; i++)
+        {
+            current = current->next;
+        }
+    }
+    else
     {
-        current = current->next;
+        current = tail;
+        for (int i = count - 1; i > index; i--)
+        {
+            current = current->prev;
+        }
     }
 
     return current;
 }
+
+void ReadingItemList::checkItem(ReadingItem *item) const
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot insert a null item.");
+    }
+
+    if (item->getObserver(CONTAINER_OBSERVER) != nullptr)
+    {
+        throw ContainerException("Item is already in a list.");
+    }
+}
+
+void ReadingItemList::checkInsertable(ReadingItem *item) const
+{
+    checkItem(item);
+    if (duplicatePolicy == REJECT_DUPLICATE_TITLES && titleLookup.find(item->titleView()) != nullptr)
+    {
+        throw ContainerException("An item with this title is already in the list.");
+    }
+}
+
+void ReadingItemList::checkInsertable(const std::vector<ReadingItem *> &batch) const
+{
+    for (ReadingItem *item : batch)
+    {
+        checkItem(item);
+    }
+
+    checkDistinctTitles(batch);
+}
+
+void ReadingItemList::checkDistinctTitles(const std::vector<ReadingItem *> &batch) const
+{
+    if (duplicatePolicy != REJECT_DUPLICATE_TITLES)
+    {
+        return;
+    }
+
+    // The batch items outlive this check, so their titles can be viewed, not copied.
+    std::unordered_set<std::string_view> batchTitles;
+    for (ReadingItem *item : batch)
+    {
+        if (titleLookup.find(item->titleView()) != nullptr || !batchTitles.insert(item->titleView()).second)
+        {
+            throw ContainerException("An item with this title is already in the list.");
+        }
+    }
+}
+
+void ReadingItemList::attach(ReadingItem *item)
+{
+    item->attachObserver(CONTAINER_OBSERVER, this);
+}
+
+// Call once the node is linked: its neighbours give its index.
+void ReadingItemList::indexPosition(ReadingItemNode *node)
+{
+    if (!positionIndex)
+    {
+        return;
+    }
+
+    int index = 0;
+    if (node->next == nullptr)
+    {
+        index = positionIndex->size();
+    }
+    else if (node->prev != nullptr)
+    {
+        index = positionIndex->rankOf(node->prev->positionEntry) + 1;
+    }
+
+    node->positionEntry = positionIndex->insertAt(index, node);
+}
+
+void ReadingItemList::rebuildPositionIndex()
+{
+    if (!positionIndex)
+    {
+        return;
+    }
+
+    positionIndex->clear();
+    for (ReadingItemNode *current = head; current != nullptr; current = current->next)
+    {
+        current->positionEntry = positionIndex->pushBack(current);
+    }
+}
+
+void ReadingItemList::linkAfter(ReadingItemNode *node, ReadingItemNode *predecessor)
+{
+    node->prev = predecessor;
+    node->next = predecessor == nullptr ? head : predecessor->next;
+    if (node->next == nullptr)
+    {
+        tail = node;
+    }
+    else
+    {
+        node->next->prev = node;
+    }
+
+    if (predecessor == nullptr)
+    {
+        head = node;
+    }
+    else
+    {
+        predecessor->next = node;
+    }
+
+    // Either end extends the positions; a node in between leaves no free key.
+    if (node->next == nullptr)
+    {
+        node->position = predecessor == nullptr ? 0 : predecessor->position + 1;
+    }
+    else if (predecessor == nullptr)
+    {
+        node->position = node->next->position - 1;
+    }
+    else
+    {
+        positionsValid = false;
+    }
+
+    indexPosition(node);
+}
+
+// Files a node linked anywhere in the list among its equal titles in the hash
+// index, in list order. The position index gives every node's index directly;
+// without it the positions are renumbered first if a middle insert or removal
+// left them stale and the title has duplicates.
+void ReadingItemList::chainInListOrder(ReadingItemNode *node)
+{
+    if (positionIndex)
+    {
+        const int index = positionIndex->rankOf(node->positionEntry);
+        ReadingItemNode *successor = titleLookup.find(node->data->titleView());
+        while (successor != nullptr && positionIndex->rankOf(successor->positionEntry) < index)
+        {
+            successor = successor->nextSameTitle;
+        }
+
+        titleLookup.insertBefore(node, successor);
+        return;
+    }
+
+    if (!positionsValid && titleLookup.find(node->data->titleView()) != nullptr)
+    {
+        renumberPositions();
+    }
+
+    titleLookup.insertInOrder(node);
+}
+
+// In TITLE_ORDER the title index and the list hold equal titles in the same
+// order, so the index entry just before the new one is the new node's list
+// predecessor, and the hash index finds that entry's node without a walk.
+void ReadingItemList::insertInTitleOrder(ReadingItem *item)
+{
+    checkInsertable(item);
+
+    ReadingItemNode *newNode = nodes.acquire(item);
+    ReadingItem *previous = titleIndex.insert(item);
+    linkAfter(newNode, previous == nullptr ? nullptr : titleLookup.nodeOf(previous));
+    titleLookup.insertBack(newNode);
+    attach(item);
+    count++;
+}
+
+// One pass over the list with the batch sorted the same way the title index
+// sorts it (stably, after equal titles already present), so both stay in step.
+void ReadingItemList::insertRangeInTitleOrder(const std::vector<ReadingItem *> &batch)
+{
+    std::vector<ReadingItem *> sorted(batch);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const ReadingItem *left, const ReadingItem *right)
+                     { return left->getCollationKey().full() < right->getCollationKey().full(); });
+
+    nodes.reserve(static_cast<int>(batch.size()));
+    ReadingItemNode *predecessor = nullptr;
+    ReadingItemNode *cursor = head;
+    for (ReadingItem *item : sorted)
+    {
+        const std::string &key = item->getCollationKey().full();
+        while (cursor != nullptr && !(key < cursor->data->getCollationKey().full()))
+        {
+            predecessor = cursor;
+            cursor = cursor->next;
+        }
+
+        ReadingItemNode *newNode = nodes.acquire(item);
+        linkAfter(newNode, predecessor);
+        titleLookup.insertBack(newNode);
+        attach(item);
+        predecessor = newNode;
+    }
+
+    titleIndex.insertBatch(batch);
+    count += static_cast<int>(batch.size());
+}
+
+// Sorts the list and rebuilds the title index from it, so equal titles appear in
+// the same order in both, which TITLE_ORDER inserts rely on.
+void ReadingItemList::restoreTitleOrder()
+{
+    mergeSortByTitle();
+    titleIndex.clear();
+    titleIndex.insertBatch(std::vector<ReadingItem *>(begin(), end()));
+}
+
+void ReadingItemList::unlink(ReadingItemNode *node)
+{
+    if (node->prev == nullptr)
+    {
+        head = node->next;
+    }
+    else
+    {
+        node->prev->next = node->next;
+    }
+
+    if (node->next == nullptr)
+    {
+        tail = node->prev;
+    }
+    else
+    {
+        node->next->prev = node->prev;
+    }
+
+    // Removing either end keeps the remaining positions contiguous.
+    if (node->prev != nullptr && node->next != nullptr)
+    {
+        positionsValid = false;
+    }
+
+    if (positionIndex)
+    {
+        positionIndex->erase(node->positionEntry);
+        node->positionEntry = nullptr;
+    }
+
+    titleLookup.remove(node);
+}
+
+void ReadingItemList::unlinkAndDelete(ReadingItemNode *node)
+{
+    delete unlinkAndRelease(node);
+}
+
+ReadingItem *ReadingItemList::unlinkAndRelease(ReadingItemNode *node)
+{
+    ReadingItem *item = node->data;
+    unlink(node);
+    titleIndex.remove(item);
+    item->detachObserver(CONTAINER_OBSERVER);
+    nodes.release(node);
+    count--;
+    return item;
+}
+
+std::vector<ReadingItem *> ReadingItemList::extractNodes(const std::vector<ReadingItemNode *> &doomed)
+{
+    std::vector<ReadingItem *> extracted;
+    extracted.reserve(doomed.size());
+    for (ReadingItemNode *node : doomed)
+    {
+        unlink(node);
+        node->data->detachObserver(CONTAINER_OBSERVER);
+        extracted.push_back(node->data);
+        nodes.release(node);
+    }
+
+    titleIndex.removeBatch(extracted);
+    count -= static_cast<int>(doomed.size());
+    return extracted;
+}
+
+// A renamed item leaves both title indexes under its old title here and is
+// filed under the new one in titleChanged. In TITLE_ORDER its node is unlinked
+// too, and relinked where the new title sorts. The item observer hears of the
+// rename first, while indexOf still gives the old index.
+void ReadingItemList::titleChanging(ReadingItem &item, std::string_view newTitle)
+{
+    if (duplicatePolicy == REJECT_DUPLICATE_TITLES && titleLookup.find(newTitle) != nullptr)
+    {
+        throw ContainerException("An item with this title is already in the list.");
+    }
+
+    if (itemObserver != nullptr)
+    {
+        itemObserver->titleChanging(item, newTitle);
+    }
+
+    renamedNode = titleLookup.nodeOf(&item);
+    titleIndex.remove(&item);
+    if (listOrder == TITLE_ORDER)
+    {
+        unlink(renamedNode);
+    }
+    else
+    {
+        titleLookup.remove(renamedNode);
+    }
+}
+
+void ReadingItemList::titleChanged(ReadingItem &item)
+{
+    ReadingItemNode *node = renamedNode;
+    renamedNode = nullptr;
+    ReadingItem *previous = titleIndex.insert(&item);
+    if (listOrder == TITLE_ORDER)
+    {
+        // Same as insertInTitleOrder: the node goes after every equal title.
+        linkAfter(node, previous == nullptr ? nullptr : titleLookup.nodeOf(previous));
+        titleLookup.insertBack(node);
+    }
+    else
+    {
+        chainInListOrder(node);
+    }
+
+    if (itemObserver != nullptr)
+    {
+        itemObserver->titleChanged(item);
+    }
+}
+
+void ReadingItemList::fieldsChanging(ReadingItem &item)
+{
+    if (itemObserver != nullptr)
+    {
+        itemObserver->fieldsChanging(item);
+    }
+}
+
+void ReadingItemList::fieldsChanged(ReadingItem &item)
+{
+    if (itemObserver != nullptr)
+    {
+        itemObserver->fieldsChanged(item);
+    }
+}
+
+// The item was deleted while still in the list: drop its node so no index
+// keeps a dangling pointer.
+void ReadingItemList::itemDestroyed(ReadingItem &item)
+{
+    ReadingItemNode *node = titleLookup.nodeOf(&item);
+    unlink(node);
+    titleIndex.remove(&item);
+    nodes.release(node);
+    count--;
+    if (itemObserver != nullptr)
+    {
+        itemObserver->itemDestroyed(item);
+    }
+}
+
+void ReadingItemList::renumberPositions() const
+{
+    int position = 0;
+    for (ReadingItemNode *current = head; current != nullptr; current = current->next)
+    {
+        current->position = position++;
+    }
+
+    positionsValid = true;
+}
+
+ReadingItemNode *ReadingItemList::splitAfter(ReadingItemNode *start, int length)
+{
+    for (int i = 1; start != nullptr && i < length; i++)
+    {
+        start = start->next;
+    }
+
+    if (start == nullptr)
+    {
+        return nullptr;
+    }
+
+    ReadingItemNode *rest = start->next;
+    start->next = nullptr;
+    return rest;
+}
+
+ReadingItemNode *ReadingItemList::mergeByTitle(ReadingItemNode *left, ReadingItemNode *right,
+                                               ReadingItemNode *mergedTail)
+{
+    while (left != nullptr && right != nullptr)
+    {
+        if (right->data->getCollationKey().full() < left->data->getCollationKey().full())
+        {
+            mergedTail->next = right;
+            right = right->next;
+        }
+        else
+        {
+            mergedTail->next = left;
+            left = left->next;
+        }
+
+        mergedTail = mergedTail->next;
+    }
+
+    mergedTail->next = (left != nullptr) ? left : right;
+    while (mergedTail->next != nullptr)
+    {
+        mergedTail = mergedTail->next;
+    }
+
+    return mergedTail;
+}
@@ -0,0 +1,151 @@
+#include "structures/reading_item_skip_list.h"
+
+ReadingItemSkipListIterator::ReadingItemSkipListIterator(SkipListNode *start)
+    : current(start) {}
+
+bool ReadingItemSkipListIterator::isValid() const
+{
+    return current != nullptr;
+}
+
+void ReadingItemSkipListIterator::next()
+{
+    if (current != nullptr)
+    {
+        current = current->links[0].next;
+    }
+}
+
+ReadingItem *ReadingItemSkipListIterator::getData() const
+{
+    if (!isValid())
+    {
+        throw ContainerException("Iterator is out of range.");
+    }
+
+    return current->data;
+}
+
+ReadingItemSkipList::ReadingItemSkipList() {}
+
+ReadingItemSkipList::~ReadingItemSkipList()
+{
+    clear();
+}
+
+bool ReadingItemSkipList::isEmpty() const
+{
+    return entries.size() == 0;
+}
+
+int ReadingItemSkipList::size() const
+{
+    return entries.size();
+}
+
+ReadingItemSkipListIterator ReadingItemSkipList::begin() const
+{
+    return ReadingItemSkipListIterator(entries.first());
+}
+
+void ReadingItemSkipList::insertFront(ReadingItem *item)
+{
+    insertAt(0, item);
+}
+
+void ReadingItemSkipList::insertBack(ReadingItem *item)
+{
+    insertAt(entries.size(), item);
+}
+
+void ReadingItemSkipList::insertAt(int index, ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot insert a null item.");
+    }
+
+    entries.insertAt(index, item);
+}
+
+bool ReadingItemSkipList::removeAt(int index)
+{
+    if (index < 0 || index >= entries.size())
+    {
+        return false;
+    }
+
+    delete entries.removeAt(index);
+    return true;
+}
+
+bool ReadingItemSkipList::deleteByTitle(std::string_view title)
+{
+    int index = findByTitle(title);
+    return index != -1 && removeAt(index);
+}
+
+ReadingItem *ReadingItemSkipList::searchByTitle(std::string_view title) const
+{
+    for (ReadingItemSkipListIterator it = begin(); it.isValid(); it.next())
+    {
+        if (it.getData()->titleView() == title)
+        {
+            return it.getData();
+        }
+    }
+
+    return nullptr;
+}
+
+int ReadingItemSkipList::findByTitle(std::string_view title) const
+{
+    int index = 0;
+    for (ReadingItemSkipListIterator it = begin(); it.isValid(); it.next(), index++)
+    {
+        if (it.getData()->titleView() == title)
+        {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+ReadingItem *ReadingItemSkipList::at(int index) const
+{
+    SkipListNode *node = entries.nodeAt(index);
+    if (node == nullptr)
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    return node->data;
+}
+
+void ReadingItemSkipList::traverse(std::ostream &os) const
+{
+    if (isEmpty())
+    {
+        os << "List is empty.\n";
+        return;
+    }
+
+    int nodeNumber = 1;
+    for (ReadingItemSkipListIterator it = begin(); it.isValid(); it.next(), nodeNumber++)
+    {
+        os << "Node " << nodeNumber << ": ";
+        it.getData()->writeDisplayName(os);
+        os << "\n";
+    }
+}
+
+void ReadingItemSkipList::clear()
+{
+    for (SkipListNode *current = entries.first(); current != nullptr; current = current->links[0].next)
+    {
+        delete current->data;
+    }
+
+    entries.clear();
+}
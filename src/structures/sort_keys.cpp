@@ -0,0 +1,127 @@
+#include "structures/sort_keys.h"
+
+#include <algorithm>
+
+void radixSortByKey(std::vector<RadixSortEntry> &entries)
+{
+    const std::size_t entryCount = entries.size();
+    if (entryCount < 2)
+    {
+        return;
+    }
+
+    std::uint64_t differingBits = 0;
+    for (const RadixSortEntry &entry : entries)
+    {
+        differingBits |= entry.key ^ entries[0].key;
+    }
+
+    std::vector<RadixSortEntry> buffer(entryCount);
+    std::size_t bucketStart[256];
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        if (((differingBits >> shift) & 0xFF) == 0)
+        {
+            continue;
+        }
+
+        std::fill(bucketStart, bucketStart + 256, 0);
+        for (const RadixSortEntry &entry : entries)
+        {
+            bucketStart[(entry.key >> shift) & 0xFF]++;
+        }
+
+        std::size_t offset = 0;
+        for (std::size_t &start : bucketStart)
+        {
+            const std::size_t bucketSize = start;
+            start = offset;
+            offset += bucketSize;
+        }
+
+        for (const RadixSortEntry &entry : entries)
+        {
+            buffer[bucketStart[(entry.key >> shift) & 0xFF]++] = entry;
+        }
+
+        entries.swap(buffer);
+    }
+}
+
+void refineOrderByNumericKey(const std::vector<std::uint64_t> &keys, std::vector<std::size_t> &order)
+{
+    std::vector<RadixSortEntry> entries;
+    entries.reserve(order.size());
+    for (std::size_t index : order)
+    {
+        entries.push_back(RadixSortEntry{keys[index], index});
+    }
+
+    radixSortByKey(entries);
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        order[i] = entries[i].index;
+    }
+}
+
+struct TextSortEntry
+{
+    std::uint64_t prefix;
+    std::string_view text;
+    std::size_t index;
+};
+
+// First eight bytes, big-endian and zero padded: comparing prefixes as integers
+// agrees with byte-wise string order whenever the prefixes differ.
+static std::uint64_t textPrefix(std::string_view text)
+{
+    std::uint64_t prefix = 0;
+    const std::size_t length = std::min<std::size_t>(text.size(), 8);
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        prefix <<= 8;
+        if (i < length)
+        {
+            prefix |= static_cast<unsigned char>(text[i]);
+        }
+    }
+
+    return prefix;
+}
+
+void refineOrderByText(const std::vector<std::string_view> &texts, bool descending,
+                       std::vector<std::size_t> &order)
+{
+    std::vector<TextSortEntry> entries;
+    entries.reserve(order.size());
+    for (std::size_t index : order)
+    {
+        entries.push_back(TextSortEntry{textPrefix(texts[index]), texts[index], index});
+    }
+
+    // Only prefix ties dereference the strings.
+    auto less = [](const TextSortEntry &left, const TextSortEntry &right)
+    {
+        if (left.prefix != right.prefix)
+        {
+            return left.prefix < right.prefix;
+        }
+
+        return left.text < right.text;
+    };
+
+    if (descending)
+    {
+        std::stable_sort(entries.begin(), entries.end(),
+                         [&less](const TextSortEntry &left, const TextSortEntry &right) { return less(right, left); });
+    }
+    else
+    {
+        std::stable_sort(entries.begin(), entries.end(), less);
+    }
+
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        order[i] = entries[i].index;
+    }
+}
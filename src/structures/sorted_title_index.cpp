@@ -0,0 +1,162 @@
+#include "structures/sorted_title_index.h"
+
+#include <utility>
+
+#include "common/container_exception.h"
+
+// Scratch buffer for folding queries, so a lookup reuses its capacity instead
+// of allocating a folded copy every time.
+static std::string &queryBuffer()
+{
+    thread_local std::string buffer;
+    return buffer;
+}
+
+ReadingItem *SortedTitleIndex::insert(ReadingItem *item)
+{
+    const std::string &key = item->getCollationKey().full();
+    const EntryNode *before =
+        entries.insertAfterLastWhere([&key](const Entry &entry) { return !(key < entry.key); }, Entry{keys.store(key), item});
+    return before == nullptr ? nullptr : before->data.item;
+}
+
+void SortedTitleIndex::insertBatch(const std::vector<ReadingItem *> &items)
+{
+    for (ReadingItem *item : items)
+    {
+        insert(item);
+    }
+}
+
+void SortedTitleIndex::absorb(SortedTitleIndex &other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+
+    // The keys move with their chunks, so the views stay valid here.
+    keys.adopt(other.keys);
+    for (const EntryNode *node = other.entries.first(); node != nullptr; node = node->links[0].next)
+    {
+        const std::string_view key = node->data.key;
+        entries.insertAfterLastWhere([key](const Entry &entry) { return !(key < entry.key); }, node->data);
+    }
+
+    other.entries.clear();
+}
+
+bool SortedTitleIndex::remove(ReadingItem *item)
+{
+    const std::string &key = item->getCollationKey().full();
+    int position = 0;
+    for (EntryNode *node = firstAtOrAfter(key, position); node != nullptr && node->data.key == key;
+         node = node->links[0].next, position++)
+    {
+        if (node->data.item == item)
+        {
+            keys.release(node->data.key);
+            entries.removeAt(position);
+            compactKeysIfSparse();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SortedTitleIndex::removeBatch(const std::vector<ReadingItem *> &items)
+{
+    for (ReadingItem *item : items)
+    {
+        remove(item);
+    }
+}
+
+int SortedTitleIndex::find(std::string_view title) const
+{
+    std::string &key = queryBuffer();
+    foldTitleInto(title, key);
+    int position = 0;
+    const EntryNode *node = firstAtOrAfter(key, position);
+    return node != nullptr && node->data.key == key ? position : -1;
+}
+
+ReadingItem *SortedTitleIndex::itemAt(int position) const
+{
+    const EntryNode *node = entries.nodeAt(position);
+    if (node == nullptr)
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    return node->data.item;
+}
+
+int SortedTitleIndex::positionOf(const ReadingItem *item) const
+{
+    const std::string &key = item->getCollationKey().full();
+    int position = 0;
+    for (const EntryNode *node = firstAtOrAfter(key, position); node != nullptr && node->data.key == key;
+         node = node->links[0].next, position++)
+    {
+        if (node->data.item == item)
+        {
+            return position;
+        }
+    }
+
+    return -1;
+}
+
+std::vector<ReadingItem *> SortedTitleIndex::itemsWithPrefix(std::string_view prefix) const
+{
+    std::string &foldedPrefix = queryBuffer();
+    foldTitleInto(prefix, foldedPrefix);
+
+    // Titles starting with the prefix are contiguous from the first key not below it.
+    std::vector<ReadingItem *> matches;
+    int position = 0;
+    for (const EntryNode *node = firstAtOrAfter(foldedPrefix, position);
+         node != nullptr && node->data.key.compare(0, foldedPrefix.size(), foldedPrefix) == 0;
+         node = node->links[0].next)
+    {
+        matches.push_back(node->data.item);
+    }
+
+    return matches;
+}
+
+int SortedTitleIndex::size() const
+{
+    return entries.size();
+}
+
+void SortedTitleIndex::clear()
+{
+    entries.clear();
+    keys.clear();
+}
+
+// First entry whose key is not below key (nullptr past the end), and its position.
+SortedTitleIndex::EntryNode *SortedTitleIndex::firstAtOrAfter(std::string_view key, int &position) const
+{
+    EntryNode *before = entries.lastWhere([key](const Entry &entry) { return entry.key < key; }, position);
+    return before == nullptr ? entries.first() : before->links[0].next;
+}
+
+void SortedTitleIndex::compactKeysIfSparse()
+{
+    if (!keys.shouldCompact())
+    {
+        return;
+    }
+
+    TitleArena compacted;
+    for (EntryNode *node = entries.first(); node != nullptr; node = node->links[0].next)
+    {
+        node->data.key = compacted.store(node->data.key);
+    }
+
+    keys = std::move(compacted);
+}
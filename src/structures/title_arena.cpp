@@ -0,0 +1,119 @@
+#include "structures/title_arena.h"
+
+#include <cstring>
+#include <utility>
+
+TitleArena::TitleArena()
+    : bumpNext(nullptr), bumpLeft(0), liveBytes(0), deadBytes(0) {}
+
+TitleArena::TitleArena(TitleArena &&other) noexcept
+    : chunks(std::move(other.chunks)), bumpNext(other.bumpNext), bumpLeft(other.bumpLeft),
+      liveBytes(other.liveBytes), deadBytes(other.deadBytes)
+{
+    other.chunks.clear();
+    other.clear();
+}
+
+TitleArena &TitleArena::operator=(TitleArena &&other) noexcept
+{
+    if (this != &other)
+    {
+        chunks = std::move(other.chunks);
+        bumpNext = other.bumpNext;
+        bumpLeft = other.bumpLeft;
+        liveBytes = other.liveBytes;
+        deadBytes = other.deadBytes;
+        other.chunks.clear();
+        other.clear();
+    }
+
+    return *this;
+}
+
+std::string_view TitleArena::store(std::string_view text)
+{
+    if (text.empty())
+    {
+        return std::string_view();
+    }
+
+    char *destination = nullptr;
+    if (text.size() > CHUNK_SIZE)
+    {
+        // An oversized string gets its own chunk and leaves the bump chunk alone.
+        chunks.emplace_back(new char[text.size()]);
+        destination = chunks.back().get();
+    }
+    else
+    {
+        if (text.size() > bumpLeft)
+        {
+            chunks.emplace_back(new char[CHUNK_SIZE]);
+            bumpNext = chunks.back().get();
+            bumpLeft = CHUNK_SIZE;
+        }
+
+        destination = bumpNext;
+        bumpNext += text.size();
+        bumpLeft -= text.size();
+    }
+
+    std::memcpy(destination, text.data(), text.size());
+    liveBytes += text.size();
+    return std::string_view(destination, text.size());
+}
+
+void TitleArena::release(std::string_view stored)
+{
+    liveBytes -= stored.size();
+    deadBytes += stored.size();
+}
+
+void TitleArena::adopt(TitleArena &other)
+{
+    if (&other == this)
+    {
+        return;
+    }
+
+    // Chunk order does not matter, so ours keep the bump position and the
+    // adopted ones only hold their existing strings.
+    for (std::unique_ptr<char[]> &chunk : other.chunks)
+    {
+        chunks.push_back(std::move(chunk));
+    }
+
+    liveBytes += other.liveBytes;
+    deadBytes += other.deadBytes;
+    other.chunks.clear();
+    other.clear();
+}
+
+bool TitleArena::shouldCompact() const
+{
+    return deadBytes > liveBytes + CHUNK_SIZE;
+}
+
+std::size_t TitleArena::getLiveBytes() const
+{
+    return liveBytes;
+}
+
+std::size_t TitleArena::getDeadBytes() const
+{
+    return deadBytes;
+}
+
+int TitleArena::chunkCount() const
+{
+    return static_cast<int>(chunks.size());
+}
+
+void TitleArena::clear()
+{
+    chunks.clear();
+    bumpNext = nullptr;
+    bumpLeft = 0;
+    liveBytes = 0;
+    deadBytes = 0;
+}
@@ -0,0 +1,331 @@
+#include "structures/title_bk_tree.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "common/container_exception.h"
+
+TitleBkTree::TitleBkTree()
+    : itemCount(0), emptyNodeCount(0) {}
+
+int TitleBkTree::editDistance(const std::string &left, const std::string &right, int limit)
+{
+    const std::string &shorter = left.size() <= right.size() ? left : right;
+    const std::string &longer = left.size() <= right.size() ? right : left;
+    if (static_cast<int>(longer.size() - shorter.size()) > limit)
+    {
+        return limit + 1;
+    }
+
+    return shorter.size() <= 64 ? bitParallelEditDistance(shorter, longer, limit)
+                                : bandedEditDistance(shorter, longer, limit);
+}
+
+int TitleBkTree::bitParallelEditDistance(const std::string &shorter, const std::string &longer, int limit)
+{
+    const std::size_t patternLength = shorter.size();
+    if (patternLength == 0)
+    {
+        return std::min(static_cast<int>(longer.size()), limit + 1);
+    }
+
+    // Myers' algorithm: one bit per pattern character holds the vertical
+    // difference (+1 / -1) between adjacent cells of the current DP column, so
+    // a whole column advances in a few word operations.
+    thread_local std::uint64_t matchMasks[256] = {};
+    for (std::size_t i = 0; i < patternLength; i++)
+    {
+        matchMasks[static_cast<unsigned char>(shorter[i])] |= std::uint64_t(1) << i;
+    }
+
+    const std::uint64_t lastBit = std::uint64_t(1) << (patternLength - 1);
+    std::uint64_t positive = patternLength == 64 ? ~std::uint64_t(0) : (lastBit << 1) - 1;
+    std::uint64_t negative = 0;
+    int score = static_cast<int>(patternLength);
+    for (std::size_t j = 0; j < longer.size(); j++)
+    {
+        const std::uint64_t equal = matchMasks[static_cast<unsigned char>(longer[j])];
+        const std::uint64_t verticalChange = equal | negative;
+        const std::uint64_t horizontalChange = (((equal & positive) + positive) ^ positive) | equal;
+        std::uint64_t horizontalPositive = negative | ~(horizontalChange | positive);
+        std::uint64_t horizontalNegative = positive & horizontalChange;
+        if (horizontalPositive & lastBit)
+        {
+            score++;
+        }
+        else if (horizontalNegative & lastBit)
+        {
+            score--;
+        }
+
+        // The bottom cell falls by at most one per remaining character.
+        if (score - static_cast<int>(longer.size() - j - 1) > limit)
+        {
+            score = limit + 1;
+            break;
+        }
+
+        horizontalPositive = (horizontalPositive << 1) | 1;
+        horizontalNegative <<= 1;
+        positive = horizontalNegative | ~(verticalChange | horizontalPositive);
+        negative = horizontalPositive & verticalChange;
+    }
+
+    for (std::size_t i = 0; i < patternLength; i++)
+    {
+        matchMasks[static_cast<unsigned char>(shorter[i])] = 0;
+    }
+
+    return std::min(score, limit + 1);
+}
+
+int TitleBkTree::bandedEditDistance(const std::string &shorter, const std::string &longer, int limit)
+{
+    const int shorterLength = static_cast<int>(shorter.size());
+    const int longerLength = static_cast<int>(longer.size());
+
+    // One row of the dynamic-programming table, reused across calls. Only cells
+    // within limit of the diagonal can stay within limit (Ukkonen's band); cells
+    // outside it hold limit + 1.
+    thread_local std::vector<int> row;
+    row.assign(shorter.size() + 1, limit + 1);
+    for (int j = 0; j <= std::min(shorterLength, limit); j++)
+    {
+        row[j] = j;
+    }
+
+    for (int i = 1; i <= longerLength; i++)
+    {
+        const int first = std::max(1, i - limit);
+        const int last = std::min(shorterLength, i + limit);
+        int diagonal = row[first - 1];
+        row[first - 1] = first == 1 && i <= limit ? i : limit + 1;
+        int rowMinimum = row[first - 1];
+        for (int j = first; j <= last; j++)
+        {
+            const int above = row[j];
+            row[j] = std::min({above + 1, row[j - 1] + 1, diagonal + (longer[i - 1] != shorter[j - 1] ? 1 : 0),
+                               limit + 1});
+            diagonal = above;
+            rowMinimum = std::min(rowMinimum, row[j]);
+        }
+
+        // Row minima never decrease, so the distance already exceeds the limit.
+        if (rowMinimum > limit)
+        {
+            return limit + 1;
+        }
+    }
+
+    return row.back();
+}
+
+void TitleBkTree::insert(ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot index a null item.");
+    }
+
+    insertKey(item->getCollationKey().full(), {item});
+    itemCount++;
+}
+
+void TitleBkTree::remove(ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        return;
+    }
+
+    auto removeFrom = [this, item](Node &node)
+    {
+        auto it = std::find(node.items.begin(), node.items.end(), item);
+        if (it == node.items.end())
+        {
+            return false;
+        }
+
+        node.items.erase(it);
+        if (node.items.empty())
+        {
+            emptyNodeCount++;
+        }
+
+        itemCount--;
+        return true;
+    };
+
+    const int index = findNode(item->getCollationKey().full());
+    const bool removed = index != -1 && removeFrom(nodes[index]);
+    if (removed && emptyNodeCount * 2 > static_cast<int>(nodes.size()))
+    {
+        rebuild();
+    }
+}
+
+std::vector<TitleMatch> TitleBkTree::findWithin(const std::string &title, int maxDistance) const
+{
+    if (maxDistance < 0)
+    {
+        throw ContainerException("Edit distance cannot be negative.");
+    }
+
+    std::vector<TitleMatch> matches;
+    if (nodes.empty())
+    {
+        return matches;
+    }
+
+    const std::string query = foldTitle(title);
+    std::vector<int> pending = {0};
+    while (!pending.empty())
+    {
+        const Node &node = nodes[pending.back()];
+        pending.pop_back();
+
+        // Children sit at edge distances up to the largest one, so the exact
+        // distance is only needed up to that plus maxDistance.
+        int largestEdge = 0;
+        for (const std::pair<int, int> &child : node.children)
+        {
+            largestEdge = std::max(largestEdge, child.first);
+        }
+
+        const int limit = largestEdge + maxDistance;
+        const int distance = editDistance(query, node.key, limit);
+        if (distance <= maxDistance)
+        {
+            for (ReadingItem *item : node.items)
+            {
+                matches.push_back(TitleMatch{item, distance});
+            }
+        }
+
+        if (distance > limit)
+        {
+            continue;
+        }
+
+        for (const std::pair<int, int> &child : node.children)
+        {
+            if (child.first >= distance - maxDistance && child.first <= distance + maxDistance)
+            {
+                pending.push_back(child.second);
+            }
+        }
+    }
+
+    std::stable_sort(matches.begin(), matches.end(),
+                     [](const TitleMatch &left, const TitleMatch &right)
+                     {
+                         if (left.distance != right.distance)
+                         {
+                             return left.distance < right.distance;
+                         }
+
+                         return left.item->getCollationKey().full() < right.item->getCollationKey().full();
+                     });
+    return matches;
+}
+
+int TitleBkTree::size() const
+{
+    return itemCount;
+}
+
+void TitleBkTree::clear()
+{
+    nodes.clear();
+    itemCount = 0;
+    emptyNodeCount = 0;
+}
+
+int TitleBkTree::findNode(const std::string &key) const
+{
+    int index = nodes.empty() ? -1 : 0;
+    while (index != -1)
+    {
+        const Node &node = nodes[index];
+        const int distance = editDistance(key, node.key, static_cast<int>(std::max(key.size(), node.key.size())));
+        if (distance == 0)
+        {
+            return index;
+        }
+
+        int next = -1;
+        for (const std::pair<int, int> &child : node.children)
+        {
+            if (child.first == distance)
+            {
+                next = child.second;
+                break;
+            }
+        }
+
+        index = next;
+    }
+
+    return -1;
+}
+
+void TitleBkTree::insertKey(const std::string &key, const std::vector<ReadingItem *> &items)
+{
+    if (nodes.empty())
+    {
+        nodes.push_back(Node{key, items, {}});
+        return;
+    }
+
+    int index = 0;
+    while (true)
+    {
+        const int distance =
+            editDistance(key, nodes[index].key, static_cast<int>(std::max(key.size(), nodes[index].key.size())));
+        if (distance == 0)
+        {
+            if (nodes[index].items.empty())
+            {
+                emptyNodeCount--;
+            }
+
+            nodes[index].items.insert(nodes[index].items.end(), items.begin(), items.end());
+            return;
+        }
+
+        int next = -1;
+        for (const std::pair<int, int> &child : nodes[index].children)
+        {
+            if (child.first == distance)
+            {
+                next = child.second;
+                break;
+            }
+        }
+
+        if (next == -1)
+        {
+            nodes[index].children.push_back({distance, static_cast<int>(nodes.size())});
+            nodes.push_back(Node{key, items, {}});
+            return;
+        }
+
+        index = next;
+    }
+}
+
+void TitleBkTree::rebuild()
+{
+    std::vector<Node> previous;
+    previous.swap(nodes);
+    emptyNodeCount = 0;
+
+    // Each node's key is its items' collation key, so nothing is refolded.
+    for (Node &node : previous)
+    {
+        if (!node.items.empty())
+        {
+            insertKey(node.key, node.items);
+        }
+    }
+}
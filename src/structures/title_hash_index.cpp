@@ -0,0 +1,329 @@
+#include "structures/title_hash_index.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "structures/reading_item_list.h"
+
+static const int MIN_CAPACITY = 16;
+
+TitleHashIndex::TitleHashIndex()
+    : occupiedCount(0), deletedCount(0) {}
+
+void TitleHashIndex::insertFront(ReadingItemNode *node)
+{
+    Slot &slot = claimSlot(node->data->titleView());
+    node->nextSameTitle = slot.first;
+    slot.first = node;
+    if (slot.last == nullptr)
+    {
+        slot.last = node;
+    }
+}
+
+void TitleHashIndex::insertBack(ReadingItemNode *node)
+{
+    Slot &slot = claimSlot(node->data->titleView());
+    node->nextSameTitle = nullptr;
+    if (slot.last == nullptr)
+    {
+        slot.first = node;
+    }
+    else
+    {
+        slot.last->nextSameTitle = node;
+    }
+
+    slot.last = node;
+}
+
+void TitleHashIndex::insertInOrder(ReadingItemNode *node)
+{
+    ReadingItemNode *successor = find(node->data->titleView());
+    while (successor != nullptr && successor->position < node->position)
+    {
+        successor = successor->nextSameTitle;
+    }
+
+    insertBefore(node, successor);
+}
+
+void TitleHashIndex::insertBefore(ReadingItemNode *node, ReadingItemNode *successor)
+{
+    Slot &slot = claimSlot(node->data->titleView());
+    ReadingItemNode *previous = nullptr;
+    ReadingItemNode *current = slot.first;
+    while (current != successor)
+    {
+        previous = current;
+        current = current->nextSameTitle;
+    }
+
+    node->nextSameTitle = current;
+    if (previous == nullptr)
+    {
+        slot.first = node;
+    }
+    else
+    {
+        previous->nextSameTitle = node;
+    }
+
+    if (current == nullptr)
+    {
+        slot.last = node;
+    }
+}
+
+void TitleHashIndex::remove(ReadingItemNode *node)
+{
+    const std::string_view title = node->data->titleView();
+    int index = findSlot(title, hashOf(title));
+    if (index != -1)
+    {
+        unchain(slots[index], node);
+    }
+}
+
+ReadingItemNode *TitleHashIndex::find(std::string_view title) const
+{
+    int index = findSlot(title, hashOf(title));
+    return index == -1 ? nullptr : slots[index].first;
+}
+
+ReadingItemNode *TitleHashIndex::nodeOf(const ReadingItem *item) const
+{
+    for (ReadingItemNode *node = find(item->titleView()); node != nullptr; node = node->nextSameTitle)
+    {
+        if (node->data == item)
+        {
+            return node;
+        }
+    }
+
+    return nullptr;
+}
+
+void TitleHashIndex::restoreChainOrder(const std::vector<ReadingItemNode *> &nodes)
+{
+    // A chain with duplicates has a head with a successor; find those slots first,
+    // before any chain is relinked.
+    std::vector<Slot *> duplicateSlots;
+    for (ReadingItemNode *node : nodes)
+    {
+        if (node->nextSameTitle == nullptr)
+        {
+            continue;
+        }
+
+        const std::string_view title = node->data->titleView();
+        int index = findSlot(title, hashOf(title));
+        if (index != -1 && slots[index].first == node)
+        {
+            duplicateSlots.push_back(&slots[index]);
+        }
+    }
+
+    std::vector<ReadingItemNode *> chain;
+    for (Slot *slot : duplicateSlots)
+    {
+        chain.clear();
+        for (ReadingItemNode *node = slot->first; node != nullptr; node = node->nextSameTitle)
+        {
+            chain.push_back(node);
+        }
+
+        std::sort(chain.begin(), chain.end(),
+                  [](const ReadingItemNode *left, const ReadingItemNode *right) { return left->position < right->position; });
+        for (std::size_t i = 0; i + 1 < chain.size(); i++)
+        {
+            chain[i]->nextSameTitle = chain[i + 1];
+        }
+
+        chain.back()->nextSameTitle = nullptr;
+        slot->first = chain.front();
+        slot->last = chain.back();
+    }
+}
+
+int TitleHashIndex::distinctTitleCount() const
+{
+    return occupiedCount;
+}
+
+void TitleHashIndex::clear()
+{
+    slots.clear();
+    titles.clear();
+    occupiedCount = 0;
+    deletedCount = 0;
+}
+
+std::size_t TitleHashIndex::hashOf(std::string_view title)
+{
+    return std::hash<std::string_view>()(title);
+}
+
+int TitleHashIndex::findSlot(std::string_view title, std::size_t hash) const
+{
+    if (slots.empty())
+    {
+        return -1;
+    }
+
+    const std::size_t mask = slots.size() - 1;
+    for (std::size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        const Slot &slot = slots[index];
+        if (slot.state == EMPTY)
+        {
+            return -1;
+        }
+
+        if (slot.state == OCCUPIED && slot.hash == hash && slot.title == title)
+        {
+            return static_cast<int>(index);
+        }
+    }
+}
+
+TitleHashIndex::Slot &TitleHashIndex::claimSlot(std::string_view title)
+{
+    // Keep at most half the slots in use (tombstones included) so probe runs stay short.
+    if ((occupiedCount + deletedCount + 1) * 2 > static_cast<int>(slots.size()))
+    {
+        int capacity = MIN_CAPACITY;
+        while (capacity < (occupiedCount + 1) * 4)
+        {
+            capacity *= 2;
+        }
+
+        rehash(capacity);
+    }
+
+    const std::size_t hash = hashOf(title);
+    const std::size_t mask = slots.size() - 1;
+    Slot *reusable = nullptr;
+
+    for (std::size_t index = hash & mask;; index = (index + 1) & mask)
+    {
+        Slot &slot = slots[index];
+        if (slot.state == OCCUPIED && slot.hash == hash && slot.title == title)
+        {
+            return slot;
+        }
+
+        if (slot.state == DELETED && reusable == nullptr)
+        {
+            reusable = &slot;
+        }
+
+        if (slot.state == EMPTY)
+        {
+            if (reusable == nullptr)
+            {
+                reusable = &slot;
+            }
+            else
+            {
+                deletedCount--;
+            }
+
+            break;
+        }
+    }
+
+    reusable->state = OCCUPIED;
+    reusable->hash = hash;
+    reusable->title = titles.store(title);
+    reusable->first = nullptr;
+    reusable->last = nullptr;
+    occupiedCount++;
+    return *reusable;
+}
+
+void TitleHashIndex::rehash(int capacity)
+{
+    std::vector<Slot> oldSlots;
+    oldSlots.swap(slots);
+    slots.resize(capacity);
+    deletedCount = 0;
+
+    // Every live title is visited anyway, so drop the dead ones from the arena too.
+    const bool compactTitles = titles.shouldCompact();
+    TitleArena compacted;
+
+    const std::size_t mask = slots.size() - 1;
+    for (Slot &oldSlot : oldSlots)
+    {
+        if (oldSlot.state != OCCUPIED)
+        {
+            continue;
+        }
+
+        std::size_t index = oldSlot.hash & mask;
+        while (slots[index].state != EMPTY)
+        {
+            index = (index + 1) & mask;
+        }
+
+        slots[index] = oldSlot;
+        if (compactTitles)
+        {
+            slots[index].title = compacted.store(oldSlot.title);
+        }
+    }
+
+    if (compactTitles)
+    {
+        titles = std::move(compacted);
+    }
+}
+
+bool TitleHashIndex::unchain(Slot &slot, ReadingItemNode *node)
+{
+    ReadingItemNode *previous = nullptr;
+    ReadingItemNode *current = slot.first;
+    while (current != nullptr && current != node)
+    {
+        previous = current;
+        current = current->nextSameTitle;
+    }
+
+    if (current == nullptr)
+    {
+        return false;
+    }
+
+    if (previous == nullptr)
+    {
+        slot.first = node->nextSameTitle;
+    }
+    else
+    {
+        previous->nextSameTitle = node->nextSameTitle;
+    }
+
+    if (slot.last == node)
+    {
+        slot.last = previous;
+    }
+
+    node->nextSameTitle = nullptr;
+    if (slot.first == nullptr)
+    {
+        slot.state = DELETED;
+        titles.release(slot.title);
+        slot.title = std::string_view();
+        occupiedCount--;
+        deletedCount++;
+        if (titles.shouldCompact())
+        {
+            // Tombstones are reused, so the table may never grow into a rehash.
+            rehash(static_cast<int>(slots.size()));
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,231 @@
+#include "structures/trigram_title_index.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "common/container_exception.h"
+
+// Posting lists longer than this many times the candidates are not intersected.
+static const std::size_t NARROWING_RATIO = 8;
+
+bool TrigramTitleIndex::isSearchable(const std::string &fragment)
+{
+    return fragment.size() >= 3;
+}
+
+void TrigramTitleIndex::insert(ReadingItem *item)
+{
+    const std::less<ReadingItem *> byAddress;
+    for (std::uint32_t trigram : trigramsOf(claimKey(item)))
+    {
+        std::vector<ReadingItem *> &posting = postings[trigram];
+        posting.insert(std::upper_bound(posting.begin(), posting.end(), item, byAddress), item);
+    }
+}
+
+void TrigramTitleIndex::insertBatch(const std::vector<ReadingItem *> &items)
+{
+    // Claim every key before touching a posting list, so a rejected item leaves
+    // the index as it was.
+    std::vector<const std::string *> keys;
+    keys.reserve(items.size());
+    try
+    {
+        for (ReadingItem *item : items)
+        {
+            keys.push_back(&claimKey(item));
+        }
+    }
+    catch (...)
+    {
+        for (std::size_t i = 0; i < keys.size(); i++)
+        {
+            indexedKeys.erase(items[i]);
+        }
+
+        throw;
+    }
+
+    std::unordered_map<std::uint32_t, std::size_t> firstAppended;
+    for (std::size_t i = 0; i < items.size(); i++)
+    {
+        ReadingItem *item = items[i];
+        for (std::uint32_t trigram : trigramsOf(*keys[i]))
+        {
+            std::vector<ReadingItem *> &posting = postings[trigram];
+            firstAppended.emplace(trigram, posting.size());
+            posting.push_back(item);
+        }
+    }
+
+    const std::less<ReadingItem *> byAddress;
+    for (const auto &entry : firstAppended)
+    {
+        std::vector<ReadingItem *> &posting = postings[entry.first];
+        auto appended = posting.begin() + static_cast<std::ptrdiff_t>(entry.second);
+        std::sort(appended, posting.end(), byAddress);
+        std::inplace_merge(posting.begin(), appended, posting.end(), byAddress);
+    }
+}
+
+void TrigramTitleIndex::remove(ReadingItem *item)
+{
+    auto keyIt = indexedKeys.find(item);
+    if (keyIt == indexedKeys.end())
+    {
+        return;
+    }
+
+    for (std::uint32_t trigram : trigramsOf(keyIt->second))
+    {
+        auto it = postings.find(trigram);
+        if (it != postings.end() && erase(it->second, item) && it->second.empty())
+        {
+            postings.erase(it);
+        }
+    }
+
+    indexedKeys.erase(keyIt);
+}
+
+std::vector<ReadingItem *> TrigramTitleIndex::search(const std::string &fragment) const
+{
+    if (!isSearchable(fragment))
+    {
+        throw ContainerException("Substring search needs at least three characters.");
+    }
+
+    const std::string foldedFragment = foldTitle(fragment);
+    std::vector<const std::vector<ReadingItem *> *> lists;
+    for (std::uint32_t trigram : trigramsOf(foldedFragment))
+    {
+        auto it = postings.find(trigram);
+        if (it == postings.end())
+        {
+            return {};
+        }
+
+        lists.push_back(&it->second);
+    }
+
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<ReadingItem *> *left, const std::vector<ReadingItem *> *right)
+              { return left->size() < right->size(); });
+
+    // Every survivor is verified against its title anyway, so stop narrowing once
+    // the remaining lists are much longer than the candidates: probing them would
+    // cost more cache misses than the verification it saves.
+    std::vector<ReadingItem *> candidates = *lists.front();
+    for (std::size_t i = 1; i < lists.size() && !candidates.empty(); i++)
+    {
+        if (lists[i]->size() > candidates.size() * NARROWING_RATIO)
+        {
+            break;
+        }
+
+        intersectInto(candidates, *lists[i]);
+    }
+
+    // Sharing every trigram does not guarantee a substring ("abcd" vs "bcdabc"),
+    // so confirm each candidate against the folded title it was indexed under.
+    std::vector<ReadingItem *> matches;
+    for (ReadingItem *candidate : candidates)
+    {
+        if (indexedKeys.find(candidate)->second.find(foldedFragment) != std::string::npos)
+        {
+            matches.push_back(candidate);
+        }
+    }
+
+    return matches;
+}
+
+int TrigramTitleIndex::size() const
+{
+    return static_cast<int>(indexedKeys.size());
+}
+
+void TrigramTitleIndex::clear()
+{
+    postings.clear();
+    indexedKeys.clear();
+}
+
+std::vector<std::uint32_t> TrigramTitleIndex::trigramsOf(const std::string &foldedText)
+{
+    std::vector<std::uint32_t> trigrams;
+    for (std::size_t i = 0; i + 3 <= foldedText.size(); i++)
+    {
+        trigrams.push_back(static_cast<std::uint32_t>(static_cast<unsigned char>(foldedText[i])) << 16 |
+                           static_cast<std::uint32_t>(static_cast<unsigned char>(foldedText[i + 1])) << 8 |
+                           static_cast<std::uint32_t>(static_cast<unsigned char>(foldedText[i + 2])));
+    }
+
+    // A title lists each item once per distinct trigram.
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+}
+
+void TrigramTitleIndex::intersectInto(std::vector<ReadingItem *> &candidates, const std::vector<ReadingItem *> &longer)
+{
+    // Galloping search: from the last match, step 1, 2, 4, ... entries ahead and
+    // then binary search the final step, so a short list costs about
+    // m log(n / m) comparisons against a long one instead of m + n.
+    const std::less<ReadingItem *> byAddress;
+    std::size_t kept = 0;
+    auto cursor = longer.begin();
+    for (ReadingItem *candidate : candidates)
+    {
+        std::size_t step = 1;
+        auto probe = cursor;
+        while (probe != longer.end() && byAddress(*probe, candidate))
+        {
+            cursor = probe + 1;
+            probe = static_cast<std::size_t>(longer.end() - cursor) > step ? cursor + step : longer.end();
+            step *= 2;
+        }
+
+        cursor = std::lower_bound(cursor, probe, candidate, byAddress);
+        if (cursor == longer.end())
+        {
+            break;
+        }
+
+        if (*cursor == candidate)
+        {
+            candidates[kept++] = candidate;
+        }
+    }
+
+    candidates.resize(kept);
+}
+
+bool TrigramTitleIndex::erase(std::vector<ReadingItem *> &posting, ReadingItem *item)
+{
+    const std::less<ReadingItem *> byAddress;
+    auto it = std::lower_bound(posting.begin(), posting.end(), item, byAddress);
+    if (it == posting.end() || *it != item)
+    {
+        return false;
+    }
+
+    posting.erase(it);
+    return true;
+}
+
+const std::string &TrigramTitleIndex::claimKey(ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot index a null item.");
+    }
+
+    auto inserted = indexedKeys.emplace(item, item->getCollationKey().full());
+    if (!inserted.second)
+    {
+        throw ContainerException("Item is already indexed.");
+    }
+
+    return inserted.first->second;
+}
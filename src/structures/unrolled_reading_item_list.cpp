@@ -0,0 +1,335 @@
+#include "structures/unrolled_reading_item_list.h"
+
+UnrolledBlock::UnrolledBlock()
+    : items(), itemCount(0), next(nullptr) {}
+
+UnrolledReadingItemListIterator::UnrolledReadingItemListIterator(UnrolledBlock *start)
+    : block(start), offset(0) {}
+
+bool UnrolledReadingItemListIterator::isValid() const
+{
+    return block != nullptr;
+}
+
+void UnrolledReadingItemListIterator::next()
+{
+    if (block == nullptr)
+    {
+        return;
+    }
+
+    offset++;
+    if (offset >= block->itemCount)
+    {
+        block = block->next;
+        offset = 0;
+    }
+}
+
+ReadingItem *UnrolledReadingItemListIterator::getData() const
+{
+    if (!isValid())
+    {
+        throw ContainerException("Iterator is out of range.");
+    }
+
+    return block->items[offset];
+}
+
+UnrolledReadingItemList::UnrolledReadingItemList()
+    : head(nullptr), tail(nullptr), count(0), blocks(0) {}
+
+UnrolledReadingItemList::~UnrolledReadingItemList()
+{
+    clear();
+}
+
+bool UnrolledReadingItemList::isEmpty() const
+{
+    return count == 0;
+}
+
+int UnrolledReadingItemList::size() const
+{
+    return count;
+}
+
+int UnrolledReadingItemList::blockCount() const
+{
+    return blocks;
+}
+
+UnrolledReadingItemListIterator UnrolledReadingItemList::begin() const
+{
+    return UnrolledReadingItemListIterator(head);
+}
+
+void UnrolledReadingItemList::insertFront(ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot insert a null item.");
+    }
+
+    if (head == nullptr || head->itemCount == UnrolledBlock::CAPACITY)
+    {
+        UnrolledBlock *block = new UnrolledBlock();
+        block->next = head;
+        head = block;
+        if (tail == nullptr)
+        {
+            tail = block;
+        }
+
+        blocks++;
+    }
+
+    for (int i = head->itemCount; i > 0; i--)
+    {
+        head->items[i] = head->items[i - 1];
+    }
+
+    head->items[0] = item;
+    head->itemCount++;
+    count++;
+}
+
+void UnrolledReadingItemList::insertBack(ReadingItem *item)
+{
+    if (item == nullptr)
+    {
+        throw ContainerException("Cannot insert a null item.");
+    }
+
+    if (tail == nullptr || tail->itemCount == UnrolledBlock::CAPACITY)
+    {
+        UnrolledBlock *block = new UnrolledBlock();
+        if (tail == nullptr)
+        {
+            head = block;
+        }
+        else
+        {
+            tail->next = block;
+        }
+
+        tail = block;
+        blocks++;
+    }
+
+    tail->items[tail->itemCount++] = item;
+    count++;
+}
+
+bool UnrolledReadingItemList::removeAt(int index)
+{
+    if (index < 0 || index >= count)
+    {
+        return false;
+    }
+
+    UnrolledBlock *previous = nullptr;
+    UnrolledBlock *block = blockAt(index, &previous);
+
+    delete block->items[index];
+    for (int i = index; i < block->itemCount - 1; i++)
+    {
+        block->items[i] = block->items[i + 1];
+    }
+
+    block->itemCount--;
+    count--;
+
+    if (block->itemCount == 0)
+    {
+        unlinkBlock(block, previous);
+    }
+    else if (block->itemCount < UnrolledBlock::HALF)
+    {
+        rebalance(block, previous);
+    }
+
+    return true;
+}
+
+bool UnrolledReadingItemList::deleteByTitle(std::string_view title)
+{
+    int index = findByTitle(title);
+    return index != -1 && removeAt(index);
+}
+
+ReadingItem *UnrolledReadingItemList::searchByTitle(std::string_view title) const
+{
+    for (UnrolledBlock *block = head; block != nullptr; block = block->next)
+    {
+        for (int i = 0; i < block->itemCount; i++)
+        {
+            if (block->items[i]->titleView() == title)
+            {
+                return block->items[i];
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+int UnrolledReadingItemList::findByTitle(std::string_view title) const
+{
+    int blockStart = 0;
+    for (UnrolledBlock *block = head; block != nullptr; block = block->next)
+    {
+        for (int i = 0; i < block->itemCount; i++)
+        {
+            if (block->items[i]->titleView() == title)
+            {
+                return blockStart + i;
+            }
+        }
+
+        blockStart += block->itemCount;
+    }
+
+    return -1;
+}
+
+ReadingItem *UnrolledReadingItemList::at(int index) const
+{
+    if (index < 0 || index >= count)
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    UnrolledBlock *block = blockAt(index, nullptr);
+    return block->items[index];
+}
+
+void UnrolledReadingItemList::traverse(std::ostream &os) const
+{
+    if (isEmpty())
+    {
+        os << "List is empty.\n";
+        return;
+    }
+
+    int nodeNumber = 1;
+    for (UnrolledReadingItemListIterator it = begin(); it.isValid(); it.next(), nodeNumber++)
+    {
+        os << "Node " << nodeNumber << ": ";
+        it.getData()->writeDisplayName(os);
+        os << "\n";
+    }
+}
+
+void UnrolledReadingItemList::clear()
+{
+    UnrolledBlock *block = head;
+    while (block != nullptr)
+    {
+        UnrolledBlock *next = block->next;
+        for (int i = 0; i < block->itemCount; i++)
+        {
+            delete block->items[i];
+        }
+
+        delete block;
+        block = next;
+    }
+
+    head = nullptr;
+    tail = nullptr;
+    count = 0;
+    blocks = 0;
+}
+
+// Finds the block holding index (0 <= index < count) and rewrites index as the
+// offset inside that block. Skips whole blocks using their occupancy counts.
+UnrolledBlock *UnrolledReadingItemList::blockAt(int &index, UnrolledBlock **previous) const
+{
+    UnrolledBlock *before = nullptr;
+    UnrolledBlock *block = head;
+    while (index >= block->itemCount)
+    {
+        index -= block->itemCount;
+        before = block;
+        block = block->next;
+    }
+
+    if (previous != nullptr)
+    {
+        *previous = before;
+    }
+
+    return block;
+}
+
+void UnrolledReadingItemList::unlinkBlock(UnrolledBlock *block, UnrolledBlock *previous)
+{
+    if (previous == nullptr)
+    {
+        head = block->next;
+    }
+    else
+    {
+        previous->next = block->next;
+    }
+
+    if (tail == block)
+    {
+        tail = previous;
+    }
+
+    delete block;
+    blocks--;
+}
+
+// Refills a block that dropped below half full from the next block, or from
+// the previous one when it is the tail. A neighbour above half full gives one
+// item; otherwise the two fit in one block and are merged.
+void UnrolledReadingItemList::rebalance(UnrolledBlock *block, UnrolledBlock *previous)
+{
+    UnrolledBlock *next = block->next;
+    if (next != nullptr)
+    {
+        if (next->itemCount <= UnrolledBlock::HALF)
+        {
+            mergeInto(block, next);
+            return;
+        }
+
+        block->items[block->itemCount++] = next->items[0];
+        next->itemCount--;
+        for (int i = 0; i < next->itemCount; i++)
+        {
+            next->items[i] = next->items[i + 1];
+        }
+    }
+    else if (previous != nullptr)
+    {
+        if (previous->itemCount <= UnrolledBlock::HALF)
+        {
+            mergeInto(previous, block);
+            return;
+        }
+
+        for (int i = block->itemCount; i > 0; i--)
+        {
+            block->items[i] = block->items[i - 1];
+        }
+
+        block->items[0] = previous->items[--previous->itemCount];
+        block->itemCount++;
+    }
+}
+
+// Appends source's items to target, its predecessor, and drops source.
+void UnrolledReadingItemList::mergeInto(UnrolledBlock *target, UnrolledBlock *source)
+{
+    for (int i = 0; i < source->itemCount; i++)
+    {
+        target->items[target->itemCount++] = source->items[i];
+    }
+
+    source->itemCount = 0;
+    unlinkBlock(source, target);
+}
@@ -0,0 +1,211 @@
+#include "structures/variant_reading_item_list.h"
+
+#include <iterator>
+
+ReadingItem &asReadingItem(ReadingItemValue &value)
+{
+    return std::visit([](auto &book) -> ReadingItem & { return book; }, value);
+}
+
+const ReadingItem &asReadingItem(const ReadingItemValue &value)
+{
+    return std::visit([](const auto &book) -> const ReadingItem & { return book; }, value);
+}
+
+VariantReadingItemList::VariantReadingItemList()
+    : count(0) {}
+
+bool VariantReadingItemList::isEmpty() const
+{
+    return count == 0;
+}
+
+int VariantReadingItemList::size() const
+{
+    return count;
+}
+
+int VariantReadingItemList::chunkCount() const
+{
+    return static_cast<int>(chunks.size());
+}
+
+void VariantReadingItemList::insertFront(ReadingItemValue value)
+{
+    if (chunks.empty() || static_cast<int>(chunks.front().size()) == CHUNK_CAPACITY)
+    {
+        // Moving the chunk vectors moves their handles, not the values inside.
+        chunks.emplace(chunks.begin());
+        chunks.front().reserve(CHUNK_CAPACITY);
+    }
+
+    chunks.front().insert(chunks.front().begin(), std::move(value));
+    count++;
+}
+
+void VariantReadingItemList::insertBack(ReadingItemValue value)
+{
+    chunkForBack().push_back(std::move(value));
+    count++;
+}
+
+void VariantReadingItemList::insertCopy(const ReadingItem &item)
+{
+    if (const PrintBook *book = dynamic_cast<const PrintBook *>(&item))
+    {
+        insertBack(*book);
+    }
+    else if (const AudioBook *book = dynamic_cast<const AudioBook *>(&item))
+    {
+        insertBack(*book);
+    }
+    else
+    {
+        throw ContainerException("Only print books and audio books can be stored by value.");
+    }
+}
+
+bool VariantReadingItemList::removeAt(int index)
+{
+    if (index < 0 || index >= count)
+    {
+        return false;
+    }
+
+    const std::pair<int, int> position = locate(index);
+    std::vector<ReadingItemValue> &chunk = chunks[position.first];
+    chunk.erase(chunk.begin() + position.second);
+    count--;
+
+    if (chunk.empty())
+    {
+        chunks.erase(chunks.begin() + position.first);
+    }
+    else if (position.first + 1 < chunkCount() &&
+             chunk.size() + chunks[position.first + 1].size() <= static_cast<std::size_t>(CHUNK_CAPACITY))
+    {
+        // Keep chunks dense, as the unrolled list does with its blocks.
+        std::vector<ReadingItemValue> &next = chunks[position.first + 1];
+        chunk.insert(chunk.end(), std::make_move_iterator(next.begin()), std::make_move_iterator(next.end()));
+        chunks.erase(chunks.begin() + position.first + 1);
+    }
+
+    return true;
+}
+
+bool VariantReadingItemList::deleteByTitle(std::string_view title)
+{
+    int index = findByTitle(title);
+    return index != -1 && removeAt(index);
+}
+
+ReadingItem *VariantReadingItemList::searchByTitle(std::string_view title)
+{
+    int index = findByTitle(title);
+    return index == -1 ? nullptr : at(index);
+}
+
+int VariantReadingItemList::findByTitle(std::string_view title) const
+{
+    int chunkStart = 0;
+    for (const std::vector<ReadingItemValue> &chunk : chunks)
+    {
+        for (std::size_t i = 0; i < chunk.size(); i++)
+        {
+            if (asReadingItem(chunk[i]).titleView() == title)
+            {
+                return chunkStart + static_cast<int>(i);
+            }
+        }
+
+        chunkStart += static_cast<int>(chunk.size());
+    }
+
+    return -1;
+}
+
+ReadingItem *VariantReadingItemList::at(int index)
+{
+    if (index < 0 || index >= count)
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    const std::pair<int, int> position = locate(index);
+    return &asReadingItem(chunks[position.first][position.second]);
+}
+
+const ReadingItem *VariantReadingItemList::at(int index) const
+{
+    if (index < 0 || index >= count)
+    {
+        throw ContainerException("Index out of range.");
+    }
+
+    const std::pair<int, int> position = locate(index);
+    return &asReadingItem(chunks[position.first][position.second]);
+}
+
+int VariantReadingItemList::getTotalPages() const
+{
+    int totalPages = 0;
+    visit([&totalPages](const auto &book) { totalPages += book.getPages(); });
+    return totalPages;
+}
+
+double VariantReadingItemList::getTotalHours() const
+{
+    double totalHours = 0.0;
+    visit([&totalHours](const auto &book) { totalHours += book.getHours(); });
+    return totalHours;
+}
+
+void VariantReadingItemList::traverse(std::ostream &os) const
+{
+    if (isEmpty())
+    {
+        os << "List is empty.\n";
+        return;
+    }
+
+    int nodeNumber = 1;
+    visit([&os, &nodeNumber](const auto &book)
+          {
+              os << "Node " << nodeNumber++ << ": ";
+              book.writeDisplayName(os);
+              os << "\n";
+          });
+}
+
+void VariantReadingItemList::clear()
+{
+    chunks.clear();
+    count = 0;
+}
+
+std::vector<ReadingItemValue> &VariantReadingItemList::chunkForBack()
+{
+    if (chunks.empty() || static_cast<int>(chunks.back().size()) == CHUNK_CAPACITY)
+    {
+        chunks.emplace_back();
+        chunks.back().reserve(CHUNK_CAPACITY);
+    }
+
+    return chunks.back();
+}
+
+std::pair<int, int> VariantReadingItemList::locate(int index) const
+{
+    for (std::size_t chunk = 0; chunk < chunks.size(); chunk++)
+    {
+        const int chunkSize = static_cast<int>(chunks[chunk].size());
+        if (index < chunkSize)
+        {
+            return {static_cast<int>(chunk), index};
+        }
+
+        index -= chunkSize;
+    }
+
+    throw ContainerException("Index out of range.");
+}
@@ -0,0 +1,87 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include "structures/array_linked_reading_item_list.h"
+
+TEST_CASE("ArrayLinkedReadingItemList links items through its slot array")
+{
+    ArrayLinkedReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(new PrintBook("Middle", 200, 8.0, MEDIUM, "Author Middle", price));
+    list.insertFront(new PrintBook("First", 120, 4.0, EASY, "Author First", price));
+    list.insertBack(new AudioBook("Last", 180, 7.0, HARD, "Narrator Last", price));
+
+    CHECK(list.size() == 3);
+    CHECK(list.at(0)->getTitle() == "First");
+    CHECK(list.at(1)->getTitle() == "Middle");
+    CHECK(list.at(2)->getTitle() == "Last");
+    CHECK(list.findByTitle("Last") == 2);
+
+    ArrayLinkedReadingItemListIterator iterator = list.begin();
+    iterator.next();
+    CHECK(iterator.getData() == list.at(1));
+}
+
+TEST_CASE("ArrayLinkedReadingItemList removes members in place and rejects foreign items")
+{
+    ArrayLinkedReadingItemList list;
+    ArrayLinkedReadingItemList other;
+    PriceInfo price(10.0, false);
+    PrintBook outsider("Outsider", 100, 1.0, EASY, "Author", price);
+
+    list.insertBack(new PrintBook("Book 1", 100, 5.0, EASY, "Author 1", price));
+    list.insertBack(new PrintBook("Book 2", 200, 10.0, MEDIUM, "Author 2", price));
+    list.insertBack(new PrintBook("Book 3", 300, 15.0, HARD, "Author 3", price));
+    ReadingItem *middle = list.at(1);
+
+    CHECK(list.contains(middle) == true);
+    CHECK(other.remove(middle) == false);
+    CHECK_THROWS_AS(other.insertBack(middle), ContainerException);
+    CHECK_THROWS_AS(list.insertBack(middle), ContainerException);
+    CHECK_THROWS_AS(list.insertFront(middle), ContainerException);
+    CHECK(list.size() == 3);
+    CHECK(list.remove(&outsider) == false);
+
+    CHECK(list.remove(middle) == true);
+    CHECK(list.size() == 2);
+    CHECK(list.at(1)->getTitle() == "Book 3");
+    CHECK(list.deleteByTitle("Book 1") == true);
+    CHECK(list.removeAt(0) == true);
+    CHECK(list.isEmpty() == true);
+}
+
+TEST_CASE("ArrayLinkedReadingItemList unlinks deleted members and reuses their slots")
+{
+    ArrayLinkedReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(new PrintBook("Book 1", 100, 5.0, EASY, "Author 1", price));
+    list.insertBack(new PrintBook("Book 2", 200, 10.0, MEDIUM, "Author 2", price));
+    list.insertBack(new PrintBook("Book 3", 300, 15.0, HARD, "Author 3", price));
+
+    delete list.at(1);
+    CHECK(list.size() == 2);
+    CHECK(list.at(1)->getTitle() == "Book 3");
+
+    list.insertFront(new PrintBook("Book 0", 50, 2.0, EASY, "Author 0", price));
+    list.insertBack(new PrintBook("Book 4", 400, 20.0, HARD, "Author 4", price));
+    CHECK(list.size() == 4);
+    CHECK(list.at(0)->getTitle() == "Book 0");
+    CHECK(list.at(3)->getTitle() == "Book 4");
+    CHECK(list.findByTitle("Book 3") == 2);
+}
+
+TEST_CASE("Copying a linked item does not copy its list membership")
+{
+    ArrayLinkedReadingItemList list;
+    PriceInfo price(10.0, false);
+    PrintBook *original = new PrintBook("Original", 100, 1.0, EASY, "Author", price);
+    list.insertBack(original);
+
+    PrintBook copy(*original);
+
+    CHECK(list.contains(original) == true);
+    CHECK(list.contains(&copy) == false);
+}
+#endif
@@ -0,0 +1,177 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "structures/title_bk_tree.h"
+
+static std::vector<std::string> titlesOf(const std::vector<TitleMatch> &matches)
+{
+    std::vector<std::string> titles;
+    for (const TitleMatch &match : matches)
+    {
+        titles.push_back(match.item->getTitle());
+    }
+
+    return titles;
+}
+
+TEST_CASE("TitleBkTree editDistance is Levenshtein with an early cutoff")
+{
+    CHECK(TitleBkTree::editDistance("kitten", "sitting", 10) == 3);
+    CHECK(TitleBkTree::editDistance("", "abc", 10) == 3);
+    CHECK(TitleBkTree::editDistance("same", "same", 0) == 0);
+    CHECK(TitleBkTree::editDistance("kitten", "sitting", 1) == 2);
+    CHECK(TitleBkTree::editDistance("a", "abcdef", 2) == 3);
+}
+
+static int referenceEditDistance(const std::string &left, const std::string &right)
+{
+    std::vector<std::vector<int>> table(left.size() + 1, std::vector<int>(right.size() + 1));
+    for (std::size_t i = 0; i <= left.size(); i++)
+    {
+        for (std::size_t j = 0; j <= right.size(); j++)
+        {
+            if (i == 0 || j == 0)
+            {
+                table[i][j] = static_cast<int>(i + j);
+            }
+            else
+            {
+                table[i][j] = std::min({table[i - 1][j] + 1, table[i][j - 1] + 1,
+                                        table[i - 1][j - 1] + (left[i - 1] != right[j - 1] ? 1 : 0)});
+            }
+        }
+    }
+
+    return table[left.size()][right.size()];
+}
+
+TEST_CASE("TitleBkTree editDistance agrees with the full table on short and long strings")
+{
+    std::mt19937 random(61);
+    for (int round = 0; round < 300; round++)
+    {
+        // Lengths straddle 64, where the bit-parallel path hands over to the band.
+        auto randomText = [&random]()
+        {
+            std::string text(random() % 80, 'a');
+            for (char &character : text)
+            {
+                character = static_cast<char>('a' + random() % 3);
+            }
+
+            return text;
+        };
+
+        const std::string left = randomText();
+        const std::string right = randomText();
+        const int expected = referenceEditDistance(left, right);
+        const int limit = static_cast<int>(random() % 12);
+        CHECK(TitleBkTree::editDistance(left, right, 200) == expected);
+        CHECK(TitleBkTree::editDistance(left, right, limit) == std::min(expected, limit + 1));
+    }
+}
+
+TEST_CASE("TitleBkTree suggests the closest titles and follows removals")
+{
+    PriceInfo price(10.0, false);
+    PrintBook work("Deep Work", 280, 6.0, MEDIUM, "Cal Newport", price);
+    PrintBook worm("Deep Worm", 10, 1.0, EASY, "Author", price);
+    PrintBook copy("deep work", 200, 4.0, EASY, "Author", price);
+    AudioBook habits("Atomic Habits", 320, 5.0, EASY, "Narrator", price);
+
+    TitleBkTree tree;
+    tree.insert(&work);
+    tree.insert(&worm);
+    tree.insert(&copy);
+    tree.insert(&habits);
+    CHECK(tree.size() == 4);
+
+    std::vector<TitleMatch> matches = tree.findWithin("Deep Wrok", 2);
+    REQUIRE(matches.size() == 2);
+    CHECK(matches[0].distance == 2);
+    CHECK(titlesOf(matches) == std::vector<std::string>{"Deep Work", "deep work"});
+    CHECK(titlesOf(tree.findWithin("Deep Wor", 1)) == std::vector<std::string>{"Deep Work", "deep work", "Deep Worm"});
+    CHECK(titlesOf(tree.findWithin("atomic habit", 1)) == std::vector<std::string>{"Atomic Habits"});
+    CHECK(tree.findWithin("Something else", 2).empty());
+    CHECK_THROWS_AS(tree.findWithin("Deep", -1), ContainerException);
+    CHECK_THROWS_AS(tree.insert(nullptr), ContainerException);
+
+    tree.remove(&work);
+    CHECK(titlesOf(tree.findWithin("Deep Work", 0)) == std::vector<std::string>{"deep work"});
+
+    // A rename is a removal under the old key and an insert under the new one.
+    tree.remove(&worm);
+    worm.setTitle("Renamed");
+    tree.insert(&worm);
+    CHECK(tree.size() == 3);
+    CHECK(titlesOf(tree.findWithin("Deep Work", 1)) == std::vector<std::string>{"deep work"});
+    CHECK(titlesOf(tree.findWithin("renamed", 0)) == std::vector<std::string>{"Renamed"});
+
+    tree.clear();
+    CHECK(tree.size() == 0);
+    CHECK(tree.findWithin("Deep Work", 3).empty());
+}
+
+TEST_CASE("TitleBkTree matches a linear scan across random inserts, removals and rebuilds")
+{
+    std::mt19937 random(16);
+    std::vector<std::unique_ptr<PrintBook>> books;
+    std::vector<PrintBook *> live;
+    TitleBkTree tree;
+
+    for (int step = 0; step < 600; step++)
+    {
+        if (live.empty() || random() % 3 != 0)
+        {
+            std::string title;
+            for (int i = 0; i < 3 + static_cast<int>(random() % 4); i++)
+            {
+                title += static_cast<char>('a' + random() % 4);
+            }
+
+            books.push_back(std::make_unique<PrintBook>(title, 100, 2.0, EASY, "Author", PriceInfo(1.0, false)));
+            live.push_back(books.back().get());
+            tree.insert(live.back());
+        }
+        else
+        {
+            const std::size_t victim = random() % live.size();
+            tree.remove(live[victim]);
+            live.erase(live.begin() + victim);
+        }
+
+        if (step % 50 == 0)
+        {
+            for (const std::string query : {"abc", "dddd", "abcabc"})
+            {
+                std::vector<std::pair<int, ReadingItem *>> expected;
+                for (PrintBook *book : live)
+                {
+                    const int distance = TitleBkTree::editDistance(query, book->getTitle(), 100);
+                    if (distance <= 2)
+                    {
+                        expected.push_back({distance, book});
+                    }
+                }
+
+                std::vector<std::pair<int, ReadingItem *>> found;
+                for (const TitleMatch &match : tree.findWithin(query, 2))
+                {
+                    found.push_back({match.distance, match.item});
+                }
+
+                std::sort(expected.begin(), expected.end());
+                std::sort(found.begin(), found.end());
+                CHECK(found == expected);
+            }
+        }
+    }
+
+    CHECK(tree.size() == static_cast<int>(live.size()));
+}
+#endif
@@ -0,0 +1,119 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "structures/reading_item_columns.h"
+
+TEST_CASE("ReadingItemColumns aggregates totals, averages and per-difficulty sums")
+{
+    ReadingItemColumns columns;
+    CHECK(columns.aggregate().itemCount == 0);
+    CHECK(columns.aggregate().averageSpeed() == doctest::Approx(0.0));
+
+    PrintBook habits("Atomic Habits", 320, 5.0, EASY, "James Clear", PriceInfo(12.5, false));
+    PrintBook work("Deep Work", 280, 7.0, MEDIUM, "Cal Newport", PriceInfo(10.0, false));
+    AudioBook learning("Deep Learning", 700, 20.0, HARD, "Narrator", PriceInfo(30.0, true));
+    columns.insert(&habits);
+    columns.insert(&work);
+    columns.insert(&learning);
+
+    const LibraryTotals totals = columns.aggregate();
+    CHECK(totals.itemCount == 3);
+    CHECK(totals.totalPages == 1300);
+    CHECK(totals.totalHours == doctest::Approx(32.0));
+    CHECK(totals.totalCost == doctest::Approx(52.5));
+    CHECK(totals.countFor(EASY) == 1);
+    CHECK(totals.pagesFor(HARD) == 700);
+    CHECK(totals.hoursFor(MEDIUM) == doctest::Approx(7.0));
+    CHECK(totals.averagePages() == doctest::Approx(1300.0 / 3));
+    CHECK(totals.averageSpeed() == doctest::Approx(1300.0 / 32.0));
+}
+
+TEST_CASE("ReadingItemColumns follows setters and removals, and rejects a second store")
+{
+    ReadingItemColumns columns;
+    PrintBook first("First", 100, 2.0, EASY, "Author", PriceInfo(5.0, false));
+    PrintBook second("Second", 200, 4.0, EASY, "Author", PriceInfo(5.0, false));
+    columns.insert(&first);
+    columns.insert(&second);
+
+    first.setPages(150);
+    first.setDifficulty(HARD);
+    second.setPrice(PriceInfo(9.0, false));
+    LibraryTotals totals = columns.aggregate();
+    CHECK(totals.totalPages == 350);
+    CHECK(totals.pagesFor(HARD) == 150);
+    CHECK(totals.totalCost == doctest::Approx(14.0));
+
+    // Removing the first row moves the last one into its place.
+    CHECK(columns.remove(&first));
+    CHECK_FALSE(columns.remove(&first));
+    second.setHours(6.0);
+    totals = columns.aggregate();
+    CHECK(totals.itemCount == 1);
+    CHECK(totals.totalHours == doctest::Approx(6.0));
+
+    ReadingItemColumns other;
+    CHECK_THROWS_AS(other.insert(&second), ContainerException);
+    CHECK_THROWS_AS(columns.insert(nullptr), ContainerException);
+
+    // Assigning to a stored item refreshes its row like the setters do.
+    const PrintBook replacement("Replacement", 500, 9.0, MEDIUM, "Author", PriceInfo(2.0, false));
+    second = replacement;
+    totals = columns.aggregate();
+    CHECK(totals.totalPages == 500);
+    CHECK(totals.pagesFor(MEDIUM) == 500);
+    CHECK(totals.totalCost == doctest::Approx(2.0));
+    CHECK(columns.contains(&second));
+    CHECK_FALSE(columns.contains(&replacement));
+
+    // A copy starts outside every store, and deleting an item leaves its store.
+    std::unique_ptr<ReadingItem> copy(second.clone());
+    CHECK_FALSE(columns.contains(copy.get()));
+    columns.insert(copy.get());
+    copy.reset();
+    CHECK(columns.size() == 1);
+}
+
+TEST_CASE("ReadingItemColumns matches a per-item loop on a random library")
+{
+    std::mt19937 random(20);
+    std::vector<std::unique_ptr<ReadingItem>> library;
+    ReadingItemColumns columns;
+    long long pages = 0;
+    double hours = 0.0;
+    long long hardPages = 0;
+    for (int i = 0; i < 1003; i++)
+    {
+        const Difficulty difficulty = static_cast<Difficulty>(EASY + random() % 3);
+        library.emplace_back(new PrintBook("Book", static_cast<int>(random() % 900), (random() % 400) / 8.0,
+                                           difficulty, "Author", PriceInfo(1.0, false)));
+        columns.insert(library.back().get());
+    }
+
+    for (std::size_t i = 0; i < library.size(); i += 7)
+    {
+        columns.remove(library[i].get());
+    }
+
+    for (std::size_t i = 0; i < library.size(); i++)
+    {
+        if (columns.contains(library[i].get()))
+        {
+            pages += library[i]->getPages();
+            hours += library[i]->getHours();
+            hardPages += library[i]->getDifficulty() == HARD ? library[i]->getPages() : 0;
+        }
+    }
+
+    const LibraryTotals totals = columns.aggregate();
+    CHECK(totals.itemCount == columns.size());
+    CHECK(totals.totalPages == pages);
+    CHECK(totals.totalHours == doctest::Approx(hours));
+    CHECK(totals.pagesFor(HARD) == hardPages);
+    CHECK(totals.countFor(EASY) + totals.countFor(MEDIUM) + totals.countFor(HARD) == totals.itemCount);
+}
+#endif
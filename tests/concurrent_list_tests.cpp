@@ -0,0 +1,150 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "structures/concurrent_reading_item_list.h"
+
+TEST_CASE("ConcurrentReadingItemList inserts, removes and iterates through a snapshot")
+{
+    ConcurrentReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(new PrintBook("Middle", 200, 8.0, MEDIUM, "Author Middle", price));
+    list.insertFront(new PrintBook("First", 120, 4.0, EASY, "Author First", price));
+    list.insertBack(new AudioBook("Last", 180, 7.0, HARD, "Narrator Last", price));
+    CHECK_THROWS_AS(list.insertBack(nullptr), ContainerException);
+    CHECK(list.size() == 3);
+
+    std::vector<std::string> titles;
+    {
+        ConcurrentReadingItemListSnapshot snapshot(list);
+        for (ReadingItem *item : snapshot)
+        {
+            titles.push_back(item->getTitle());
+        }
+    }
+
+    CHECK(titles == std::vector<std::string>{"First", "Middle", "Last"});
+    CHECK(list.deleteByTitle("Middle"));
+    CHECK(list.removeAt(1));
+    CHECK_FALSE(list.removeAt(1));
+    CHECK(list.size() == 1);
+    CHECK(list.getRetiredCount() == 0);
+
+    // Appending after the tail was removed links from the new tail.
+    list.insertBack(new PrintBook("Next", 100, 2.0, EASY, "Author", price));
+    std::ostringstream output;
+    ConcurrentReadingItemListSnapshot(list).traverse(output);
+    CHECK(output.str().find("Node 2: Next") != std::string::npos);
+}
+
+TEST_CASE("ConcurrentReadingItemList defers reclamation until older snapshots finish")
+{
+    ConcurrentReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Alpha", 100, 2.0, EASY, "Author", price));
+    list.insertBack(new PrintBook("Beta", 150, 3.0, EASY, "Author", price));
+
+    {
+        ConcurrentReadingItemListSnapshot snapshot(list);
+        ConcurrentReadingItemListIterator it = snapshot.begin();
+        ReadingItem *alpha = it.getData();
+
+        CHECK(list.remove(alpha));
+        CHECK(list.size() == 1);
+        CHECK(list.getRetiredCount() == 1);
+
+        // The removed item is still alive and still leads on to the live list.
+        CHECK(alpha->getTitle() == "Alpha");
+        it.next();
+        CHECK(it.getData()->getTitle() == "Beta");
+
+        // A snapshot taken after the removal does not see the node.
+        ConcurrentReadingItemListSnapshot later(list);
+        CHECK((*later.begin())->getTitle() == "Beta");
+        CHECK(list.reclaim() == 0);
+    }
+
+    CHECK(list.reclaim() == 1);
+    CHECK(list.getRetiredCount() == 0);
+
+    {
+        ConcurrentReadingItemListSnapshot snapshot(list);
+        ConcurrentReadingItemListIterator it = snapshot.begin();
+        list.clear();
+        CHECK(list.isEmpty());
+        CHECK(snapshot.begin() == snapshot.end());
+        CHECK(list.getRetiredCount() == 1);
+        CHECK(it.getData()->getTitle() == "Beta");
+    }
+
+    CHECK(list.reclaim() == 1);
+}
+
+TEST_CASE("ConcurrentReadingItemList readers see a consistent list while a writer mutates it")
+{
+    ConcurrentReadingItemList list;
+    PriceInfo price(10.0, false);
+    const int readerCount = 4;
+    const int writeCount = 20000;
+
+    std::atomic<bool> writing(true);
+    std::atomic<int> orderViolations(0);
+    std::atomic<long long> snapshotsTaken(0);
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < readerCount; r++)
+    {
+        readers.emplace_back([&]()
+        {
+            while (writing.load())
+            {
+                ConcurrentReadingItemListSnapshot snapshot(list);
+                int previousPages = -1;
+                for (ReadingItem *item : snapshot)
+                {
+                    // Items are appended with increasing page counts, so any torn
+                    // or reclaimed link shows up as a decrease (or as an ASan error).
+                    if (item->getPages() <= previousPages || item->getTitle().empty())
+                    {
+                        orderViolations++;
+                    }
+
+                    previousPages = item->getPages();
+                }
+
+                snapshotsTaken++;
+            }
+        });
+    }
+
+    for (int i = 1; i <= writeCount; i++)
+    {
+        list.insertBack(new PrintBook("Item " + std::to_string(i), i, 1.0, EASY, "Author", price));
+        if (list.size() > 64)
+        {
+            list.removeAt(i % 3 == 0 ? 0 : list.size() / 2);
+        }
+
+        if (i % 5000 == 0 && i < writeCount)
+        {
+            list.deleteByTitle("Item " + std::to_string(i - 1));
+        }
+    }
+
+    writing.store(false);
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+
+    CHECK(orderViolations.load() == 0);
+    CHECK(snapshotsTaken.load() > 0);
+    CHECK(list.size() == 64);
+    list.reclaim();
+    CHECK(list.getRetiredCount() == 0);
+}
+#endif
@@ -1,6 +1,12 @@
 #ifdef _DEBUG
 #include "support/test_headers.h"
 
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <random>
+#include <vector>
+
 TEST_CASE("ReadingItemList insertFront handles inserting into an empty list")
 {
     ReadingItemList list;
@@ -85,4 +91,784 @@ TEST_CASE("ReadingItemList iterator starts at the front and advances through the
     CHECK(iterator.isValid() == false);
     CHECK_THROWS_AS(iterator.getData(), ContainerException);
 }
+
+TEST_CASE("ReadingItemList sortByTitle relinks nodes and keeps equal titles in insertion order")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    ReadingItem *firstDune = new PrintBook("Dune", 500, 10.0, HARD, "Frank Herbert", price);
+    ReadingItem *secondDune = new AudioBook("Dune", 500, 21.0, HARD, "Scott Brick", price);
+
+    list.insertBack(new PrintBook("Zen", 100, 2.0, EASY, "Author Z", price));
+    list.insertBack(firstDune);
+    list.insertBack(new PrintBook("Beta", 100, 2.0, EASY, "Author B", price));
+    list.insertBack(secondDune);
+    list.insertBack(new PrintBook("Alpha", 100, 2.0, EASY, "Author A", price));
+
+    list.sortByTitle();
+
+    CHECK(list.size() == 5);
+    CHECK(list.at(0)->getTitle() == "Alpha");
+    CHECK(list.at(1)->getTitle() == "Beta");
+    CHECK(list.at(2) == firstDune);
+    CHECK(list.at(3) == secondDune);
+    CHECK(list.at(4)->getTitle() == "Zen");
+
+    list.insertBack(new PrintBook("After Sort", 100, 2.0, EASY, "Author", price));
+    CHECK(list.at(5)->getTitle() == "After Sort");
+}
+
+TEST_CASE("ReadingItemList binarySearchByTitle answers from the title index without sorting")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(new PrintBook("Mike", 100, 2.0, EASY, "Author M", price));
+    list.insertFront(new PrintBook("Zulu", 100, 2.0, EASY, "Author Z", price));
+    list.insertBack(new PrintBook("Alpha", 100, 2.0, EASY, "Author A", price));
+
+    CHECK(list.binarySearchByTitle("Alpha") == 0);
+    CHECK(list.binarySearchByTitle("Mike") == 1);
+    CHECK(list.binarySearchByTitle("Zulu") == 2);
+    CHECK(list.at(0)->getTitle() == "Zulu");
+
+    CHECK(list.deleteByTitle("Mike") == true);
+    CHECK(list.removeAt(0) == true);
+    CHECK(list.binarySearchByTitle("Mike") == -1);
+    CHECK(list.binarySearchByTitle("Zulu") == -1);
+    CHECK(list.binarySearchByTitle("Alpha") == 0);
+
+    list.clear();
+    CHECK(list.binarySearchByTitle("Alpha") == -1);
+}
+
+TEST_CASE("ReadingItemList title lookups use the earliest duplicate and track positions")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    ReadingItem *backDune = new PrintBook("Dune", 500, 10.0, HARD, "Frank Herbert", price);
+    ReadingItem *frontDune = new AudioBook("Dune", 500, 21.0, HARD, "Scott Brick", price);
+
+    list.insertBack(new PrintBook("Emma", 300, 6.0, MEDIUM, "Jane Austen", price));
+    list.insertBack(backDune);
+    list.insertBack(new PrintBook("Ulysses", 700, 30.0, HARD, "James Joyce", price));
+    list.insertFront(frontDune);
+
+    CHECK(list.searchByTitle("Dune") == frontDune);
+    CHECK(list.findByTitle("Dune") == 0);
+    CHECK(list.findByTitle("Ulysses") == 3);
+
+    CHECK(list.deleteByTitle("Dune") == true);
+    CHECK(list.searchByTitle("Dune") == backDune);
+    CHECK(list.findByTitle("Dune") == 1);
+
+    CHECK(list.removeAt(1) == true);
+    CHECK(list.searchByTitle("Dune") == nullptr);
+    CHECK(list.findByTitle("Ulysses") == 1);
+    CHECK(list.findByTitle("Emma") == 0);
+}
+
+TEST_CASE("ReadingItemList title hash index stays consistent across many inserts and removals")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    for (int i = 0; i < 500; i++)
+    {
+        list.insertBack(new PrintBook("Book " + std::to_string(i), 100, 1.0, EASY, "Author", price));
+    }
+
+    for (int i = 0; i < 500; i += 2)
+    {
+        CHECK(list.deleteByTitle("Book " + std::to_string(i)) == true);
+    }
+
+    CHECK(list.size() == 250);
+    CHECK(list.searchByTitle("Book 10") == nullptr);
+    CHECK(list.searchByTitle("Book 11") != nullptr);
+    CHECK(list.findByTitle("Book 11") == 5);
+    CHECK(list.findByTitle("Book 499") == 249);
+}
+
+TEST_CASE("ReadingItemList can reject duplicate titles")
+{
+    ReadingItemList list(REJECT_DUPLICATE_TITLES);
+    PriceInfo price(10.0, false);
+    PrintBook duplicate("Dune", 500, 10.0, HARD, "Someone Else", price);
+
+    list.insertBack(new PrintBook("Dune", 500, 10.0, HARD, "Frank Herbert", price));
+
+    CHECK(list.getDuplicatePolicy() == REJECT_DUPLICATE_TITLES);
+    CHECK_THROWS_AS(list.insertBack(&duplicate), ContainerException);
+    CHECK_THROWS_AS(list.insertFront(&duplicate), ContainerException);
+    CHECK(list.size() == 1);
+}
+
+TEST_CASE("ReadingItemList removes by handle or item pointer without a positional walk")
+{
+    ReadingItemList list;
+    ReadingItemList other;
+    PriceInfo price(10.0, false);
+    PrintBook outsider("Outsider", 100, 1.0, EASY, "Author", price);
+
+    list.insertBack(new PrintBook("Book 1", 100, 5.0, EASY, "Author 1", price));
+    list.insertBack(new PrintBook("Book 2", 200, 10.0, MEDIUM, "Author 2", price));
+    list.insertBack(new PrintBook("Book 3", 300, 15.0, HARD, "Author 3", price));
+    list.insertBack(new PrintBook("Book 4", 400, 20.0, HARD, "Author 4", price));
+
+    ReadingItemNode *handle = list.handleAt(2);
+    list.insertFront(new PrintBook("Book 0", 50, 1.0, EASY, "Author 0", price));
+
+    CHECK(handle->data->getTitle() == "Book 3");
+    CHECK(other.remove(handle) == false);
+    CHECK(list.remove(handle) == true);
+    CHECK(list.findByTitle("Book 4") == 3);
+
+    CHECK(list.remove(&outsider) == false);
+    CHECK(list.remove(list.at(1)) == true);
+    CHECK(list.handleAt(3) == nullptr);
+    CHECK(list.size() == 3);
+    CHECK(list.at(0)->getTitle() == "Book 0");
+    CHECK(list.at(1)->getTitle() == "Book 2");
+    CHECK(list.at(2)->getTitle() == "Book 4");
+}
+
+TEST_CASE("ReadingItemList reverse iterator walks from the back to the front")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(new PrintBook("First", 100, 5.0, EASY, "Author 1", price));
+    list.insertBack(new PrintBook("Second", 200, 10.0, MEDIUM, "Author 2", price));
+    list.insertFront(new PrintBook("Zeroth", 50, 1.0, EASY, "Author 0", price));
+    list.removeAt(1);
+
+    ReadingItemListReverseIterator iterator = list.rbegin();
+    CHECK(iterator.getData()->getTitle() == "Second");
+    iterator.next();
+    CHECK(iterator.getData()->getTitle() == "Zeroth");
+    iterator.next();
+    CHECK(iterator.isValid() == false);
+    CHECK_THROWS_AS(iterator.getData(), ContainerException);
+}
+
+TEST_CASE("ReadingItemList iterators work with range-for and standard algorithms")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(new PrintBook("Alpha", 100, 2.0, EASY, "Author A", price));
+    list.insertBack(new AudioBook("Beta", 250, 5.0, HARD, "Narrator B", price));
+    list.insertBack(new PrintBook("Gamma", 150, 3.0, MEDIUM, "Author G", price));
+
+    int pages = 0;
+    for (const ReadingItem *item : list)
+    {
+        pages += item->getPages();
+    }
+
+    CHECK(pages == 500);
+    CHECK(std::distance(list.begin(), list.end()) == 3);
+    CHECK(std::count_if(list.cbegin(), list.cend(),
+                        [](const ReadingItem *item) { return item->getDifficulty() != EASY; }) == 2);
+
+    ReadingItemList::iterator found = std::find_if(list.begin(), list.end(),
+                                                   [](const ReadingItem *item) { return item->getTitle() == "Beta"; });
+    REQUIRE(found != list.end());
+    CHECK((*found)->getPages() == 250);
+    CHECK((*std::prev(list.end()))->getTitle() == "Gamma");
+
+    std::vector<std::string> reversed;
+    for (ReadingItemList::reverse_iterator it = list.rbegin(); it != list.rend(); ++it)
+    {
+        reversed.push_back((*it)->getTitle());
+    }
+
+    CHECK(reversed == std::vector<std::string>{"Gamma", "Beta", "Alpha"});
+    CHECK((*std::prev(list.rend()))->getTitle() == "Alpha");
+}
+
+TEST_CASE("ReadingItemList insertRange appends a batch and keeps every index current")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Middle", 100, 2.0, EASY, "Author", price));
+
+    list.insertRange({new PrintBook("Zeta", 100, 2.0, EASY, "Author", price),
+                      new AudioBook("Alpha", 200, 4.0, HARD, "Narrator", price),
+                      new PrintBook("Middle", 150, 3.0, MEDIUM, "Author", price)});
+
+    REQUIRE(list.size() == 4);
+    CHECK(list.at(1)->getTitle() == "Zeta");
+    CHECK(list.at(3)->getPages() == 150);
+    CHECK(list.findByTitle("Alpha") == 2);
+    CHECK(list.findByTitle("Middle") == 0);
+    CHECK(list.binarySearchByTitle("Alpha") == 0);
+    CHECK(list.binarySearchByTitle("Zeta") == 3);
+
+    list.insertRange({});
+    CHECK(list.size() == 4);
+}
+
+TEST_CASE("ReadingItemList insertRange rejects the whole batch before changing anything")
+{
+    ReadingItemList list(REJECT_DUPLICATE_TITLES);
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Existing", 100, 2.0, EASY, "Author", price));
+
+    PrintBook fresh("Fresh", 100, 2.0, EASY, "Author", price);
+    PrintBook clash("Existing", 100, 2.0, EASY, "Author", price);
+    PrintBook repeat("Fresh", 120, 2.0, EASY, "Author", price);
+
+    CHECK_THROWS_AS(list.insertRange({&fresh, &clash}), ContainerException);
+    CHECK_THROWS_AS(list.insertRange({&fresh, &repeat}), ContainerException);
+    CHECK_THROWS_AS(list.insertRange({&fresh, nullptr}), ContainerException);
+    CHECK(list.size() == 1);
+    CHECK(list.searchByTitle("Fresh") == nullptr);
+}
+
+TEST_CASE("ReadingItemList splice moves every node and leaves the source empty")
+{
+    ReadingItemList target;
+    ReadingItemList source;
+    PriceInfo price(10.0, false);
+
+    target.insertBack(new PrintBook("Delta", 100, 2.0, EASY, "Author", price));
+    target.insertBack(new PrintBook("Bravo", 100, 2.0, EASY, "Author", price));
+    source.insertBack(new PrintBook("Charlie", 100, 2.0, EASY, "Author", price));
+    source.insertBack(new PrintBook("Alpha", 100, 2.0, EASY, "Author", price));
+    source.insertBack(new PrintBook("Bravo", 120, 2.0, EASY, "Author", price));
+
+    target.splice(source);
+
+    CHECK(source.isEmpty());
+    CHECK(source.getNodePoolStats().liveNodes == 0);
+    CHECK(source.searchByTitle("Alpha") == nullptr);
+    REQUIRE(target.size() == 5);
+    CHECK(target.getNodePoolStats().liveNodes == 5);
+    CHECK(target.at(2)->getTitle() == "Charlie");
+    CHECK((*std::prev(target.end()))->getPages() == 120);
+    CHECK(target.findByTitle("Alpha") == 3);
+    CHECK(target.binarySearchByTitle("Alpha") == 0);
+    CHECK(target.binarySearchByTitle("Delta") == 4);
+
+    target.removeAt(1);
+    CHECK(target.searchByTitle("Bravo")->getPages() == 120);
+
+    // The drained source keeps working with its own pool.
+    source.insertBack(new PrintBook("Echo", 100, 2.0, EASY, "Author", price));
+    CHECK(source.findByTitle("Echo") == 0);
+}
+
+TEST_CASE("ReadingItemList splice respects the reject-duplicates policy")
+{
+    ReadingItemList target(REJECT_DUPLICATE_TITLES);
+    ReadingItemList source;
+    PriceInfo price(10.0, false);
+
+    target.insertBack(new PrintBook("Alpha", 100, 2.0, EASY, "Author", price));
+    source.insertBack(new PrintBook("Beta", 100, 2.0, EASY, "Author", price));
+    source.insertBack(new PrintBook("Alpha", 100, 2.0, EASY, "Author", price));
+
+    CHECK_THROWS_AS(target.splice(source), ContainerException);
+    CHECK(target.size() == 1);
+    CHECK(source.size() == 2);
+}
+
+TEST_CASE("ReadingItemList sortBy orders by numeric keys and keeps ties stable")
+{
+    ReadingItemList list;
+    list.insertBack(new PrintBook("A", 300, 6.0, HARD, "Author", PriceInfo(12.5, false)));
+    list.insertBack(new AudioBook("B", 120, 2.0, EASY, "Narrator", PriceInfo(-1.0, false)));
+    list.insertBack(new PrintBook("C", 120, 9.5, MEDIUM, "Author", PriceInfo(0.0, true)));
+    list.insertBack(new AudioBook("D", 80, 2.0, HARD, "Narrator", PriceInfo(3.25, false)));
+
+    list.sortBy<SortByPages>();
+    std::vector<std::string> titles;
+    for (const ReadingItem *item : list)
+    {
+        titles.push_back(item->getTitle());
+    }
+    CHECK(titles == std::vector<std::string>{"D", "B", "C", "A"});
+
+    list.sortBy<SortByCost>();
+    CHECK(list.at(0)->getTitle() == "B");
+    CHECK(list.at(3)->getTitle() == "A");
+
+    list.sortBy<SortByDifficulty, Descending<SortByHours>>();
+    titles.clear();
+    for (const ReadingItem *item : list)
+    {
+        titles.push_back(item->getTitle());
+    }
+    CHECK(titles == std::vector<std::string>{"B", "C", "A", "D"});
+    CHECK(list.findByTitle("A") == 2);
+    CHECK((*list.rbegin())->getTitle() == "D");
+
+    list.sortBy<Descending<SortByTitle>>();
+    CHECK(list.at(0)->getTitle() == "D");
+    CHECK(list.binarySearchByTitle("D") == 3);
+}
+
+TEST_CASE("ReadingItemList sortBy matches a comparison sort on random composite keys")
+{
+    ReadingItemList list;
+    std::mt19937 random(7);
+    PriceInfo price(10.0, false);
+    for (int i = 0; i < 2000; i++)
+    {
+        const int pages = static_cast<int>(random() % 50) - 10;
+        const double hours = static_cast<double>(random() % 40) / 4.0;
+        const Difficulty difficulty = static_cast<Difficulty>(EASY + static_cast<int>(random() % 3));
+        // Half the titles share a long prefix, so ties past the first eight bytes are covered.
+        const std::string title = (i % 2 == 0 ? "T" : "Shared title prefix ") + std::to_string(random() % 300);
+        list.insertBack(new PrintBook(title, pages, hours, difficulty, "Author", price));
+    }
+
+    std::vector<const ReadingItem *> expected(list.begin(), list.end());
+    std::stable_sort(expected.begin(), expected.end(), [](const ReadingItem *left, const ReadingItem *right)
+    {
+        if (left->getDifficulty() != right->getDifficulty())
+        {
+            return left->getDifficulty() < right->getDifficulty();
+        }
+        if (left->getPages() != right->getPages())
+        {
+            return left->getPages() > right->getPages();
+        }
+        return left->getCollationKey().full() < right->getCollationKey().full();
+    });
+
+    list.sortBy<SortByDifficulty, Descending<SortByPages>, SortByTitle>();
+    CHECK(std::vector<const ReadingItem *>(list.begin(), list.end()) == expected);
+
+    // Duplicate titles stay chained in the new list order.
+    const ReadingItem *firstDuplicate = nullptr;
+    for (const ReadingItem *item : list)
+    {
+        if (item->getTitle() == expected.front()->getTitle())
+        {
+            firstDuplicate = item;
+            break;
+        }
+    }
+    CHECK(list.searchByTitle(expected.front()->getTitle()) == firstDuplicate);
+}
+
+TEST_CASE("ReadingItemList searchByTitlePrefix returns matches in title order")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Clean Code", 400, 8.0, MEDIUM, "Robert Martin", price));
+    list.insertBack(new PrintBook("Atomic Habits", 300, 6.0, EASY, "James Clear", price));
+    list.insertBack(new PrintBook("Clean Architecture", 350, 7.0, HARD, "Robert Martin", price));
+    list.insertBack(new AudioBook("Cleaning Up", 120, 2.0, EASY, "Narrator", price));
+    list.insertBack(new PrintBook("Clear Thinking", 250, 5.0, MEDIUM, "Shane Parrish", price));
+
+    std::vector<ReadingItem *> matches = list.searchByTitlePrefix("Clean");
+    REQUIRE(matches.size() == 3);
+    CHECK(matches[0]->getTitle() == "Clean Architecture");
+    CHECK(matches[1]->getTitle() == "Clean Code");
+    CHECK(matches[2]->getTitle() == "Cleaning Up");
+
+    CHECK(list.searchByTitlePrefix("Cle").size() == 4);
+    CHECK(list.searchByTitlePrefix("").size() == 5);
+    CHECK(list.searchByTitlePrefix("Clean Code, 2nd").empty());
+    CHECK(list.searchByTitlePrefix("Zen").empty());
+
+    list.deleteByTitle("Clean Code");
+    CHECK(list.searchByTitlePrefix("Clean").size() == 2);
+}
+
+TEST_CASE("ReadingItemList title order, binary search and prefix search ignore case")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("the hobbit", 300, 6.0, EASY, "Tolkien", price));
+    list.insertBack(new PrintBook("Zen", 200, 3.0, EASY, "Author", price));
+    list.insertBack(new PrintBook("The Hobbit", 310, 6.5, MEDIUM, "Tolkien", price));
+    list.insertBack(new PrintBook("apple", 100, 1.0, HARD, "Author", price));
+
+    CHECK(list.binarySearchByTitle("THE HOBBIT") == 1);
+    CHECK(list.binarySearchByTitle("Apple") == 0);
+    CHECK(list.searchByTitlePrefix("tHe").size() == 2);
+
+    list.sortByTitle();
+    std::vector<std::string> titles;
+    for (const ReadingItem *item : list)
+    {
+        titles.push_back(item->getTitle());
+    }
+    CHECK(titles == std::vector<std::string>{"apple", "the hobbit", "The Hobbit", "Zen"});
+
+    list.sortBy<SortByTitleIgnoringArticles>();
+    CHECK(list.at(0)->getTitle() == "apple");
+    CHECK(list.at(1)->getTitle() == "the hobbit");
+    CHECK(list.at(3)->getTitle() == "Zen");
+
+    // The key follows renames.
+    list.at(3)->setTitle("Aardvark");
+    list.sortBy<SortByTitle>();
+    CHECK(list.at(0)->getTitle() == "Aardvark");
+}
+
+TEST_CASE("ReadingItemList in TITLE_ORDER keeps every insert path sorted and in step with its indexes")
+{
+    ReadingItemList list(ALLOW_DUPLICATE_TITLES, TITLE_ORDER);
+    list.setPositionIndex(true);
+    std::mt19937 random(18);
+    PriceInfo price(10.0, false);
+    auto makeTitle = [&random]()
+    {
+        // Few distinct titles, mixed case, so equal keys and exact duplicates are common.
+        return std::string(1, static_cast<char>((random() % 2 ? 'A' : 'a') + random() % 6)) +
+               std::to_string(random() % 5);
+    };
+    auto makeBook = [&makeTitle, &price]() { return new PrintBook(makeTitle(), 100, 1.0, EASY, "Author", price); };
+
+    for (int step = 0; step < 400; step++)
+    {
+        const int action = static_cast<int>(random() % 6);
+        if (action == 0)
+        {
+            list.insertFront(makeBook());
+        }
+        else if (action == 1 && !list.isEmpty())
+        {
+            list.removeAt(static_cast<int>(random() % list.size()));
+        }
+        else if (action == 2)
+        {
+            list.insertRange({makeBook(), makeBook(), makeBook()});
+        }
+        else if (action == 3 && step % 50 == 3)
+        {
+            ReadingItemList other;
+            other.insertBack(makeBook());
+            other.insertBack(makeBook());
+            list.splice(other);
+        }
+        else if (action == 4 && !list.isEmpty())
+        {
+            // A rename moves the item to where its new title sorts.
+            list.at(static_cast<int>(random() % list.size()))->setTitle(makeTitle());
+        }
+        else
+        {
+            list.insertBack(makeBook());
+        }
+
+        int index = 0;
+        bool sorted = true;
+        bool ranksMatch = true;
+        const ReadingItem *previous = nullptr;
+        for (const ReadingItem *item : list)
+        {
+            sorted = sorted && (previous == nullptr ||
+                                !(item->getCollationKey().full() < previous->getCollationKey().full()));
+            ranksMatch = ranksMatch && list.titleRankOf(item) == index && list.at(index) == item;
+            previous = item;
+            index++;
+        }
+
+        CHECK(sorted);
+        CHECK(ranksMatch);
+    }
+
+    // Exact duplicates still resolve to the earliest one in list order.
+    for (const ReadingItem *item : list)
+    {
+        const int first = list.findByTitle(item->getTitle());
+        CHECK(list.at(first)->getTitle() == item->getTitle());
+        CHECK(first <= list.titleRankOf(item));
+    }
+
+    CHECK(list.getOrder() == TITLE_ORDER);
+    list.sortBy<SortByPages>();
+    CHECK(list.getOrder() == INSERTION_ORDER);
+}
+
+TEST_CASE("ReadingItemList setOrder sorts once and later inserts land in place")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Mango", 100, 1.0, EASY, "Author", price));
+    list.insertBack(new PrintBook("apple", 100, 1.0, EASY, "Author", price));
+    list.insertFront(new PrintBook("Zucchini", 100, 1.0, EASY, "Author", price));
+    CHECK(list.at(0)->getTitle() == "Zucchini");
+
+    list.setOrder(TITLE_ORDER);
+    list.insertBack(new PrintBook("Banana", 100, 1.0, EASY, "Author", price));
+    list.insertFront(new PrintBook("Yam", 100, 1.0, EASY, "Author", price));
+
+    std::vector<std::string> titles;
+    for (const ReadingItem *item : list)
+    {
+        titles.push_back(item->getTitle());
+    }
+    CHECK(titles == std::vector<std::string>{"apple", "Banana", "Mango", "Yam", "Zucchini"});
+    CHECK(list.binarySearchByTitle("Mango") == list.findByTitle("Mango"));
+
+    list.setOrder(INSERTION_ORDER);
+    list.insertBack(new PrintBook("Aardvark", 100, 1.0, EASY, "Author", price));
+    CHECK(list.at(5)->getTitle() == "Aardvark");
+}
+
+TEST_CASE("ReadingItemList removeIf drops every match in one pass and keeps the indexes current")
+{
+    ReadingItemList list;
+    std::mt19937 random(19);
+    PriceInfo price(10.0, false);
+    std::vector<std::string> model;
+    for (int i = 0; i < 300; i++)
+    {
+        const std::string title = "Book " + std::to_string(random() % 100);
+        list.insertBack(new PrintBook(title, static_cast<int>(random() % 500) + 1, 1.0, EASY, "Author", price));
+        model.push_back(title);
+    }
+
+    auto isShort = [](const ReadingItem *item) { return item->getPages() < 250; };
+    std::vector<std::string> expected;
+    for (const ReadingItem *item : list)
+    {
+        if (!isShort(item))
+        {
+            expected.push_back(item->getTitle());
+        }
+    }
+
+    const int removed = list.removeIf(isShort);
+    CHECK(removed == 300 - static_cast<int>(expected.size()));
+    CHECK(list.size() == static_cast<int>(expected.size()));
+    CHECK(std::equal(list.begin(), list.end(), expected.begin(), expected.end(),
+                     [](const ReadingItem *item, const std::string &title) { return item->getTitle() == title; }));
+
+    bool indexesAgree = true;
+    for (int i = 0; i < list.size(); i++)
+    {
+        const ReadingItem *item = list.at(i);
+        indexesAgree = indexesAgree && list.searchByTitle(item->getTitle()) != nullptr &&
+                       list.at(list.findByTitle(item->getTitle()))->getTitle() == item->getTitle() &&
+                       list.titleRankOf(item) != -1;
+    }
+    CHECK(indexesAgree);
+    CHECK(list.removeIf(isShort) == 0);
+    CHECK(list.getNodePoolStats().liveNodes == list.size());
+}
+
+TEST_CASE("ReadingItemList extractIf hands matches back and a throwing predicate changes nothing")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Keep", 100, 1.0, EASY, "Author", price));
+    list.insertBack(new PrintBook("Take one", 100, 1.0, HARD, "Author", price));
+    list.insertBack(new PrintBook("Take two", 100, 1.0, HARD, "Author", price));
+
+    CHECK_THROWS_AS(list.removeIf([](const ReadingItem *item) -> bool
+                                  {
+                                      if (item->getTitle() == "Take two")
+                                      {
+                                          throw ContainerException("stop");
+                                      }
+
+                                      return true;
+                                  }),
+                    ContainerException);
+    CHECK(list.size() == 3);
+
+    std::vector<ReadingItem *> taken =
+        list.extractIf([](const ReadingItem *item) { return item->getDifficulty() == HARD; });
+    REQUIRE(taken.size() == 2);
+    CHECK(taken[0]->getTitle() == "Take one");
+    CHECK(taken[1]->getTitle() == "Take two");
+    CHECK(list.size() == 1);
+    CHECK(list.searchByTitle("Take one") == nullptr);
+    CHECK(list.binarySearchByTitle("Keep") == 0);
+
+    for (ReadingItem *item : taken)
+    {
+        delete item;
+    }
+}
+
+TEST_CASE("ReadingItemList re-keys its title hash index when an item is renamed in place")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Dune", 500, 10.0, HARD, "Frank Herbert", price));
+    list.insertBack(new PrintBook("Emma", 300, 6.0, EASY, "Jane Austen", price));
+    list.insertBack(new PrintBook("Dune", 520, 10.0, HARD, "Frank Herbert", price));
+
+    list.at(0)->setTitle("Arrakis");
+
+    CHECK(list.searchByTitle("Arrakis") == list.at(0));
+    CHECK(list.findByTitle("Arrakis") == 0);
+    CHECK(list.searchByTitle("Dune") == list.at(2));
+    CHECK(list.findByTitle("Dune") == 2);
+
+    // Renaming back joins the duplicate chain at the item's place in the list.
+    list.at(0)->setTitle("Dune");
+    CHECK(list.findByTitle("Dune") == 0);
+
+    CHECK(list.deleteByTitle("Dune"));
+    CHECK(list.size() == 2);
+    CHECK(list.at(0)->getTitle() == "Emma");
+    CHECK(list.findByTitle("Dune") == 1);
+}
+
+TEST_CASE("ReadingItemList vetoes a rename that would duplicate a title it rejects")
+{
+    ReadingItemList list(REJECT_DUPLICATE_TITLES);
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Dune", 500, 10.0, HARD, "Frank Herbert", price));
+    list.insertBack(new PrintBook("Emma", 300, 6.0, EASY, "Jane Austen", price));
+
+    CHECK_THROWS_AS(list.at(1)->setTitle("Dune"), ContainerException);
+    CHECK(list.at(1)->getTitle() == "Emma");
+    CHECK(list.findByTitle("Emma") == 1);
+
+    list.at(1)->setTitle("Persuasion");
+    CHECK(list.findByTitle("Persuasion") == 1);
+    CHECK(list.searchByTitle("Emma") == nullptr);
+}
+
+TEST_CASE("ReadingItemList holds an item in one list at a time and forgets deleted items")
+{
+    ReadingItemList list;
+    ReadingItemList other;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Dune", 500, 10.0, HARD, "Frank Herbert", price));
+    list.insertBack(new PrintBook("Emma", 300, 6.0, EASY, "Jane Austen", price));
+
+    CHECK_THROWS_AS(other.insertBack(list.at(0)), ContainerException);
+
+    // An item deleted from outside the list takes its node with it.
+    delete list.at(0);
+    CHECK(list.size() == 1);
+    CHECK(list.searchByTitle("Dune") == nullptr);
+    CHECK(list.findByTitle("Emma") == 0);
+
+    // Extracted items are free to join another list.
+    std::vector<ReadingItem *> taken = list.extractIf([](const ReadingItem *) { return true; });
+    REQUIRE(taken.size() == 1);
+    other.insertBack(taken[0]);
+    taken[0]->setTitle("Sense and Sensibility");
+    CHECK(other.findByTitle("Sense and Sensibility") == 0);
+}
+
+TEST_CASE("ReadingItemList re-keys its sorted title index when an item is renamed in place")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Middlemarch", 800, 20.0, HARD, "George Eliot", price));
+    list.insertBack(new PrintBook("Beloved", 320, 8.0, MEDIUM, "Toni Morrison", price));
+    list.insertBack(new PrintBook("Walden", 350, 9.0, MEDIUM, "Henry Thoreau", price));
+
+    list.at(1)->setTitle("Zuleika Dobson");
+
+    CHECK(list.binarySearchByTitle("Beloved") == -1);
+    CHECK(list.binarySearchByTitle("zuleika dobson") == 2);
+    CHECK(list.titleRankOf(list.at(1)) == 2);
+    CHECK(list.titleRankOf(list.at(0)) == 0);
+    REQUIRE(list.searchByTitlePrefix("Zu").size() == 1);
+    CHECK(list.searchByTitlePrefix("Zu")[0] == list.at(1));
+    CHECK(list.searchByTitlePrefix("Be").empty());
+
+    // Positions follow insertion order, so they are unchanged by the rename.
+    CHECK(list.at(1)->getTitle() == "Zuleika Dobson");
+    CHECK(list.removeAt(1));
+    CHECK(list.binarySearchByTitle("Zuleika Dobson") == -1);
+    CHECK(list.binarySearchByTitle("Walden") == 1);
+}
+
+TEST_CASE("ReadingItemList in TITLE_ORDER moves a renamed item to its new place")
+{
+    ReadingItemList list(ALLOW_DUPLICATE_TITLES, TITLE_ORDER);
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Beloved", 320, 8.0, MEDIUM, "Toni Morrison", price));
+    list.insertBack(new PrintBook("Middlemarch", 800, 20.0, HARD, "George Eliot", price));
+    list.insertBack(new PrintBook("Walden", 350, 9.0, MEDIUM, "Henry Thoreau", price));
+
+    list.at(0)->setTitle("Persuasion");
+    CHECK(list.at(0)->getTitle() == "Middlemarch");
+    CHECK(list.at(1)->getTitle() == "Persuasion");
+    CHECK(list.findByTitle("Persuasion") == 1);
+    CHECK(list.binarySearchByTitle("Persuasion") == 1);
+
+    list.at(2)->setTitle("Adam Bede");
+    CHECK(list.at(0)->getTitle() == "Adam Bede");
+    CHECK(list.findByTitle("Walden") == -1);
+
+    // Later inserts still find their place next to the renamed items.
+    list.insertBack(new PrintBook("Orlando", 330, 7.0, EASY, "Virginia Woolf", price));
+    std::vector<std::string> titles;
+    for (const ReadingItem *item : list)
+    {
+        titles.push_back(item->getTitle());
+    }
+    CHECK(titles == std::vector<std::string>{"Adam Bede", "Middlemarch", "Orlando", "Persuasion"});
+}
+
+TEST_CASE("ReadingItemList extract hands one item back without deleting it")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.insertBack(new PrintBook("Dune", 500, 10.0, HARD, "Frank Herbert", price));
+    list.insertBack(new PrintBook("Emma", 300, 6.0, EASY, "Jane Austen", price));
+
+    ReadingItem *dune = list.at(0);
+    CHECK(list.extract(dune));
+    CHECK_FALSE(list.extract(dune));
+    CHECK_FALSE(list.extract(nullptr));
+    CHECK(list.size() == 1);
+    CHECK(list.searchByTitle("Dune") == nullptr);
+    CHECK(list.binarySearchByTitle("Dune") == -1);
+
+    // No longer observed by the list, so a rename leaves it alone.
+    dune->setTitle("Emma");
+    CHECK(list.findByTitle("Emma") == 0);
+    delete dune;
+    CHECK(list.size() == 1);
+}
+
+// Fills a list with itemCount single inserts, then drains it from both ends,
+// and returns the seconds taken.
+static double buildAndDrain(int itemCount)
+{
+    std::mt19937 random(2026);
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < itemCount; i++)
+    {
+        list.insertBack(new PrintBook("Title " + std::to_string(random() % itemCount) + " " + std::to_string(i), 100,
+                                      1.0, EASY, "Author", price));
+    }
+
+    REQUIRE(list.size() == itemCount);
+    CHECK(list.binarySearchByTitle(list.at(0)->getTitle()) == list.titleRankOf(list.at(0)));
+
+    while (list.size() > itemCount / 2)
+    {
+        list.removeAt(0);
+    }
+
+    while (!list.isEmpty())
+    {
+        list.remove(list.at(list.size() - 1));
+    }
+
+    CHECK(list.binarySearchByTitle("Title 1 1") == -1);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+TEST_CASE("ReadingItemList builds and drains a large list without quadratic index updates")
+{
+    // Four times the items should take about four times as long. An index that
+    // shifts an array on every update takes about sixteen times as long instead.
+    const double small = buildAndDrain(25000);
+    const double large = buildAndDrain(100000);
+    CHECK(large < small * 10.0);
+}
 #endif
@@ -137,7 +137,7 @@ TEST_CASE("Manager sequentialSearchByTitle finds correct index")
     CHECK(manager.sequentialSearchByTitle("Hobbit") == -1);
 }
 
-TEST_CASE("Manager sortByTitle orders items correctly (Bubble Sort)")
+TEST_CASE("Manager sortByTitle orders items correctly (Merge Sort)")
 {
     Manager manager;
     PriceInfo price(10.0, false);
@@ -255,4 +255,337 @@ TEST_CASE("Manager loadItemsFromJson returns false for malformed JSON")
 
     std::remove(badPath.c_str());
 }
+
+TEST_CASE("Manager loadItemsFromJson adds nothing when a later entry is invalid")
+{
+    const std::string badPath = "src/app/partial_reading_seed_data.json";
+    {
+        std::ofstream badFile(badPath);
+        badFile << "[ { \"type\": \"print\", \"title\": \"Valid\", \"pages\": 100, \"hours\": 2.0,"
+                   " \"difficulty\": 0, \"author\": \"A\" },"
+                   " { \"type\": \"comic\", \"title\": \"Invalid\", \"pages\": 10, \"hours\": 1.0,"
+                   " \"difficulty\": 0 } ]";
+    }
+
+    Manager manager;
+    CHECK(manager.loadItemsFromJson(badPath) == false);
+    CHECK(manager.getItemCount() == 0);
+    CHECK(manager.countByDifficulty(EASY) == 0);
+
+    std::remove(badPath.c_str());
+}
+
+TEST_CASE("Manager addItems updates the list, difficulty map and recent additions")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("First", 100, 2.0, HARD, "Author", price));
+
+    manager.addItems({new PrintBook("Second", 120, 2.5, EASY, "Author", price),
+                      new AudioBook("Third", 200, 4.0, EASY, "Narrator", price)});
+
+    CHECK(manager.getItemCount() == 3);
+    CHECK(manager[2]->getTitle() == "Third");
+    CHECK(manager.countByDifficulty(EASY) == 2);
+    CHECK(manager.countByDifficulty(HARD) == 1);
+    CHECK(manager.peekRecentAddition() == "Third");
+}
+
+TEST_CASE("Manager history keeps versions that can be reopened and diffed")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("Zulu", 100, 2.0, EASY, "Author", price));
+    CHECK_FALSE(manager.isHistoryEnabled());
+    CHECK(manager.getVersionCount() == 0);
+
+    manager.enableHistory(3);
+    manager.addItems({new PrintBook("Alpha", 120, 2.5, MEDIUM, "Author", price),
+                      new AudioBook("Mike", 200, 4.0, HARD, "Narrator", price)});
+    manager.removeItem(0);
+
+    REQUIRE(manager.getVersionCount() == 3);
+    CHECK(manager.getVersion(0).size() == 1);
+    CHECK(manager.getVersion(1).size() == 3);
+    CHECK(manager.getVersion(2).size() == 2);
+    CHECK(manager.getVersion(2).at(0)->getTitle() == "Alpha");
+
+    // Version 0 still holds the removed item after the live one was deleted.
+    CHECK(manager.getVersion(0).at(0)->getTitle() == "Zulu");
+
+    PersistentListDiff import = manager.diffVersions(0, 1);
+    CHECK(import.added.size() == 2);
+    CHECK(import.removed.empty());
+
+    manager.sortByTitle();
+    CHECK(manager.getVersionCount() == 3);
+    CHECK(manager.getVersion(2).at(0)->getTitle() == "Alpha");
+    CHECK(manager.getVersion(2).at(1)->getTitle() == "Mike");
+    CHECK(manager.diffVersions(1, 2).added.empty());
+    CHECK_THROWS_AS(manager.getVersion(3), ContainerException);
+}
+
+TEST_CASE("Manager sortBy reorders the library and records a matching version")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("Long", 400, 9.0, MEDIUM, "Author", price));
+    manager.addItem(new AudioBook("Short", 90, 1.5, MEDIUM, "Narrator", price));
+    manager.addItem(new PrintBook("Easy", 150, 3.0, EASY, "Author", price));
+    manager.enableHistory();
+
+    manager.sortBy<SortByDifficulty, Descending<SortByHours>>();
+
+    CHECK(manager[0]->getTitle() == "Easy");
+    CHECK(manager[1]->getTitle() == "Long");
+    CHECK(manager[2]->getTitle() == "Short");
+    REQUIRE(manager.getVersionCount() == 2);
+    CHECK(manager.getVersion(1).at(1)->getTitle() == "Long");
+    CHECK(manager.getVersion(0).at(1)->getTitle() == "Short");
+}
+
+TEST_CASE("Manager history follows renames and field edits through sorts and removals")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("Alpha", 100, 2.0, EASY, "Author", price));
+    manager.addItem(new PrintBook("Beta", 200, 4.0, MEDIUM, "Author", price));
+    manager.enableHistory();
+
+    manager[0]->setTitle("Zeta");
+    manager[1]->setPages(250);
+    REQUIRE(manager.getVersionCount() == 3);
+    CHECK(manager.getVersion(2).at(0)->getTitle() == "Zeta");
+    CHECK(manager.getVersion(2).at(1)->getPages() == 250);
+    CHECK(manager.getVersion(0).at(0)->getTitle() == "Alpha");
+    CHECK(manager.getVersion(1).at(1)->getPages() == 200);
+
+    manager.sortByTitle();
+    const PersistentReadingItemList &sorted = manager.getVersion(manager.getVersionCount() - 1);
+    REQUIRE(sorted.size() == 2);
+    CHECK(sorted.at(0)->getTitle() == "Beta");
+    CHECK(sorted.at(1)->getTitle() == "Zeta");
+
+    manager.removeItem(0);
+    const PersistentReadingItemList &current = manager.getVersion(manager.getVersionCount() - 1);
+    REQUIRE(current.size() == 1);
+    CHECK(manager[0]->getTitle() == "Zeta");
+    CHECK(current.at(0)->getTitle() == "Zeta");
+
+    // In title order a rename moves the item, and its clone moves with it.
+    manager.addItem(new PrintBook("Omega", 300, 6.0, HARD, "Author", price));
+    manager.setKeepSortedByTitle(true);
+    manager[1]->setTitle("Aardvark");
+    const PersistentReadingItemList &renamed = manager.getVersion(manager.getVersionCount() - 1);
+    REQUIRE(renamed.size() == 2);
+    CHECK(manager[0]->getTitle() == "Aardvark");
+    CHECK(renamed.at(0)->getTitle() == "Aardvark");
+    CHECK(renamed.at(1)->getTitle() == "Omega");
+}
+
+TEST_CASE("Manager searchByTitlePrefix follows additions and removals")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("Deep Work", 280, 6.0, MEDIUM, "Cal Newport", price));
+    manager.addItem(new AudioBook("Deep Learning", 700, 20.0, HARD, "Narrator", price));
+    CHECK(manager.searchByTitlePrefix("Deep").size() == 2);
+
+    manager.removeItem(0);
+    std::vector<ReadingItem *> matches = manager.searchByTitlePrefix("Deep");
+    REQUIRE(matches.size() == 1);
+    CHECK(matches[0]->getTitle() == "Deep Learning");
+}
+
+TEST_CASE("Manager searchByTitleFragment follows additions, batches and removals")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("Deep Work", 280, 6.0, MEDIUM, "Cal Newport", price));
+    manager.addItems({new AudioBook("Atomic Habits", 320, 5.0, EASY, "Narrator", price),
+                      new PrintBook("Hard Work Pays", 200, 4.0, HARD, "Author", price)});
+
+    CHECK(manager.searchByTitleFragment("work").size() == 2);
+    CHECK(manager.searchByTitleFragment("HABIT").size() == 1);
+    CHECK(manager.searchByTitleFragment("ts").size() == 1);
+
+    manager.removeItem(0);
+    std::vector<ReadingItem *> matches = manager.searchByTitleFragment("Work");
+    REQUIRE(matches.size() == 1);
+    CHECK(matches[0]->getTitle() == "Hard Work Pays");
+}
+
+TEST_CASE("Manager suggestTitles offers near misses closest first")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("Deep Work", 280, 6.0, MEDIUM, "Cal Newport", price));
+    manager.addItems({new AudioBook("Deep Worm", 320, 5.0, EASY, "Narrator", price),
+                      new PrintBook("Atomic Habits", 200, 4.0, HARD, "Author", price)});
+
+    std::vector<ReadingItem *> suggestions = manager.suggestTitles("deep work");
+    REQUIRE(suggestions.size() == 2);
+    CHECK(suggestions[0]->getTitle() == "Deep Work");
+    CHECK(suggestions[1]->getTitle() == "Deep Worm");
+    CHECK(manager.suggestTitles("Atomic Habit", 0).empty());
+
+    manager.removeItem(0);
+    suggestions = manager.suggestTitles("Deep Work", 1);
+    REQUIRE(suggestions.size() == 1);
+    CHECK(suggestions[0]->getTitle() == "Deep Worm");
+}
+
+TEST_CASE("Manager suggestTitles and fragment search follow a rename through operator[]")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("Deep Work", 280, 6.0, MEDIUM, "Cal Newport", price));
+    manager.addItem(new PrintBook("Atomic Habits", 200, 4.0, HARD, "James Clear", price));
+
+    manager[0]->setTitle("Slow Productivity");
+
+    CHECK(manager.suggestTitles("Deep Work").empty());
+    std::vector<ReadingItem *> suggestions = manager.suggestTitles("Slow Productivty", 1);
+    REQUIRE(suggestions.size() == 1);
+    CHECK(suggestions[0] == manager[0]);
+    CHECK(manager.searchByTitleFragment("Deep").empty());
+    CHECK(manager.searchByTitleFragment("product").size() == 1);
+
+    // Deleting an item directly still takes it out of every index.
+    delete manager[0];
+    CHECK(manager.getItemCount() == 1);
+    CHECK(manager.suggestTitles("Slow Productivity").empty());
+    CHECK(manager.countByDifficulty(MEDIUM) == 0);
+    CHECK(manager.getDistinctDifficultyLevelCount() == 1);
+}
+
+TEST_CASE("Manager indexes, counts and totals follow an assignment through operator[]")
+{
+    Manager manager;
+    manager.addItem(new PrintBook("Deep Work", 280, 6.0, MEDIUM, "Cal Newport", PriceInfo(10.0, false)));
+    manager.addItem(new PrintBook("Atomic Habits", 200, 4.0, HARD, "James Clear", PriceInfo(8.0, false)));
+    const PrintBook other("Slow Productivity", 250, 5.0, EASY, "Cal Newport", PriceInfo(15.0, false));
+
+    *manager[0] = other;
+
+    CHECK(manager[0]->getTitle() == "Slow Productivity");
+    CHECK(manager.sequentialSearchByTitle("Slow Productivity") == 0);
+    CHECK(manager.searchByTitleFragment("Deep").empty());
+    CHECK(manager.searchByTitleFragment("product").size() == 1);
+    CHECK(manager.suggestTitles("Deep Work").empty());
+    CHECK(manager.countByDifficulty(MEDIUM) == 0);
+    CHECK(manager.countByDifficulty(EASY) == 1);
+    CHECK(manager.getTotalPages() == 450);
+    CHECK(manager.getTotals().totalCost == doctest::Approx(18.0));
+
+    // Assigning the full PrintBook also carries the price into the columns.
+    static_cast<PrintBook &>(*manager[0]) = other;
+    CHECK(manager.getTotals().totalCost == doctest::Approx(23.0));
+
+    manager[1]->setDifficulty(EASY);
+    CHECK(manager.countByDifficulty(HARD) == 0);
+    CHECK(manager.countByDifficulty(EASY) == 2);
+    CHECK(manager.getDistinctDifficultyLevelCount() == 1);
+}
+
+TEST_CASE("Manager fragment search forgets an item renamed to a title sharing a trigram")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("abcdef", 100, 1.0, EASY, "Author", price));
+
+    manager[0]->setTitle("abcxyz");
+    CHECK(manager.searchByTitleFragment("bcd").empty());
+    CHECK(manager.searchByTitleFragment("bcx").size() == 1);
+
+    CHECK(manager.removeItem(0));
+    CHECK(manager.searchByTitleFragment("bcd").empty());
+    CHECK(manager.searchByTitleFragment("abc").empty());
+}
+
+TEST_CASE("Manager keeps title order for adds and imports, and its history follows")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("Middlemarch", 880, 30.0, HARD, "George Eliot", price));
+    manager.addItem(new PrintBook("Beloved", 320, 10.0, MEDIUM, "Toni Morrison", price));
+    manager.enableHistory();
+    manager.setKeepSortedByTitle(true);
+    CHECK(manager.isKeptSortedByTitle());
+
+    manager.addItem(new PrintBook("Emma", 470, 15.0, MEDIUM, "Jane Austen", price));
+    manager.addItems({new AudioBook("Walden", 350, 12.0, EASY, "Narrator", price),
+                      new PrintBook("Austerlitz", 420, 14.0, HARD, "W. G. Sebald", price)});
+
+    const std::vector<std::string> expected = {"Austerlitz", "Beloved", "Emma", "Middlemarch", "Walden"};
+    const PersistentReadingItemList &current = manager.getVersion(manager.getVersionCount() - 1);
+    REQUIRE(current.size() == 5);
+    for (int i = 0; i < 5; i++)
+    {
+        CHECK(manager[i]->getTitle() == expected[i]);
+        CHECK(current.at(i)->getTitle() == expected[i]);
+    }
+
+    CHECK(manager.binarySearchByTitle("Emma") == 2);
+
+    manager.sortBy<SortByPages>();
+    CHECK_FALSE(manager.isKeptSortedByTitle());
+}
+
+TEST_CASE("Manager removeWhere removes all matches and updates counts, queue, searches and history")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    manager.addItem(new PrintBook("Hard One", 500, 10.0, HARD, "Author", price));
+    manager.addItem(new PrintBook("Easy One", 100, 2.0, EASY, "Author", price));
+    manager.addItem(new AudioBook("Hard Two", 600, 12.0, HARD, "Narrator", price));
+    manager.addItem(new PrintBook("Medium One", 300, 6.0, MEDIUM, "Author", price));
+    manager.enableHistory();
+
+    const int removed = manager.removeWhere([](const ReadingItem *item) { return item->getDifficulty() == HARD; });
+    CHECK(removed == 2);
+    CHECK(manager.getItemCount() == 2);
+    CHECK(manager.countByDifficulty(HARD) == 0);
+    CHECK(manager.getDistinctDifficultyLevelCount() == 2);
+    CHECK(manager.hasPendingRemovals());
+    CHECK(manager.searchByTitleFragment("hard").empty());
+    CHECK(manager.suggestTitles("Hard One").empty());
+
+    REQUIRE(manager.getVersionCount() == 2);
+    const PersistentReadingItemList &current = manager.getVersion(1);
+    REQUIRE(current.size() == 2);
+    CHECK(current.at(0)->getTitle() == "Easy One");
+    CHECK(current.at(1)->getTitle() == "Medium One");
+    CHECK(manager.diffVersions(0, 1).removed.size() == 2);
+
+    CHECK(manager.removeWhere([](const ReadingItem *) { return false; }) == 0);
+    CHECK(manager.getVersionCount() == 2);
+}
+
+TEST_CASE("Manager totals follow adds, edits, batches and removals")
+{
+    Manager manager;
+    PriceInfo price(10.0, false);
+    ReadingItem *first = new PrintBook("Book 1", 100, 5.0, EASY, "Author 1", price);
+    manager += first;
+    manager.addItems({new PrintBook("Book 2", 200, 10.0, HARD, "Author 2", price),
+                      new AudioBook("Book 3", 300, 5.0, HARD, "Narrator", price)});
+
+    CHECK(manager.getTotalPages() == 600);
+    CHECK(manager.getTotalHours() == doctest::Approx(20.0));
+    CHECK(manager.getAvgSpeed() == doctest::Approx(30.0));
+
+    first->setHours(10.0);
+    LibraryTotals totals = manager.getTotals();
+    CHECK(totals.totalHours == doctest::Approx(25.0));
+    CHECK(totals.hoursFor(HARD) == doctest::Approx(15.0));
+    CHECK(totals.totalCost == doctest::Approx(30.0));
+
+    CHECK(manager.removeItem(0));
+    manager.removeWhere([](const ReadingItem *item) { return item->getPages() == 300; });
+    totals = manager.getTotals();
+    CHECK(totals.itemCount == 1);
+    CHECK(totals.totalPages == 200);
+    CHECK(totals.countFor(HARD) == 1);
+}
 #endif
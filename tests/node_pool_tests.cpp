@@ -0,0 +1,73 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include "structures/node_pool.h"
+#include "structures/queue.h"
+
+TEST_CASE("NodePool carves nodes from chunks and recycles released nodes")
+{
+    NodePool<QueueNode> pool;
+
+    QueueNode *first = pool.acquire("first", nullptr);
+    QueueNode *second = pool.acquire("second", first);
+
+    CHECK(second->data == "second");
+    CHECK(second->next == first);
+    CHECK(pool.getStats().chunkAllocations == 1);
+    CHECK(pool.getStats().liveNodes == 2);
+
+    pool.release(first);
+    CHECK(pool.getStats().liveNodes == 1);
+    CHECK(pool.getStats().recycledNodes == 1);
+
+    QueueNode *reused = pool.acquire("reused", nullptr);
+    CHECK(reused == first);
+    CHECK(pool.getStats().recycledNodes == 0);
+    CHECK(pool.getStats().chunkAllocations == 1);
+
+    pool.destroy(reused);
+    pool.destroy(second);
+    pool.releaseAll();
+    CHECK(pool.getStats().liveNodes == 0);
+}
+
+TEST_CASE("ReadingItemList allocates nodes in chunks and releases them on clear")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    for (int i = 0; i < 100; i++)
+    {
+        list.insertBack(new PrintBook("Book " + std::to_string(i), 100, 1.0, EASY, "Author", price));
+    }
+
+    NodePoolStats filled = list.getNodePoolStats();
+    CHECK(filled.liveNodes == 100);
+    CHECK(filled.chunkAllocations < 10);
+
+    list.removeAt(50);
+    list.insertFront(new PrintBook("Recycled", 100, 1.0, EASY, "Author", price));
+    CHECK(list.getNodePoolStats().chunkAllocations == filled.chunkAllocations);
+    CHECK(list.getNodePoolStats().liveNodes == 100);
+
+    list.clear();
+    CHECK(list.getNodePoolStats().liveNodes == 0);
+    CHECK(list.getNodePoolStats().recycledNodes == 0);
+}
+
+TEST_CASE("Queue reuses pooled nodes across enqueue and dequeue")
+{
+    Queue queue;
+    for (int round = 0; round < 50; round++)
+    {
+        queue.enqueue("title");
+        queue.dequeue();
+    }
+
+    queue.enqueue("kept");
+
+    CHECK(queue.getNodePoolStats().chunkAllocations == 1);
+    CHECK(queue.getNodePoolStats().liveNodes == 1);
+    CHECK(queue.front() == "kept");
+}
+#endif
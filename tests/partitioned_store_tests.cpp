@@ -0,0 +1,119 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "structures/partitioned_reading_item_store.h"
+
+TEST_CASE("PartitionedReadingItemStore keeps each type dense and the mixed order intact")
+{
+    PartitionedReadingItemStore store;
+    PriceInfo price(10.0, false);
+    store.insertBack(PrintBook("Middle", 200, 8.0, MEDIUM, "Author Middle", price));
+    store.insertBack(AudioBook("Audio", 300, 9.0, HARD, "Narrator", price));
+    store.insertFront(AudioBook("First", 120, 4.0, EASY, "Narrator First", price));
+    store.insertBack(PrintBook("Last", 180, 7.0, HARD, "Author Last", price));
+
+    CHECK(store.size() == 4);
+    CHECK(store.countOf<PrintBook>() == 2);
+    CHECK(store.countOf<AudioBook>() == 2);
+    CHECK(store.itemsOf<PrintBook>()[1].getTitle() == "Last");
+    CHECK(store.itemsOf<AudioBook>()[0].getTitle() == "First");
+
+    CHECK(store.at(0)->getTitle() == "First");
+    CHECK(store.at(1)->getTitle() == "Middle");
+    CHECK(store.at(2)->getTitle() == "Audio");
+    CHECK(store.at(3)->getTitle() == "Last");
+    CHECK_THROWS_AS(store.at(4), ContainerException);
+    CHECK(store.findByTitle("Audio") == 2);
+    CHECK(store.getTotalPages() == 800);
+    CHECK(store.getTotalHours() == doctest::Approx(28.0));
+
+    std::ostringstream out;
+    store.traverse(out);
+    CHECK(out.str() == "Node 1: First (narrated by Narrator First)\nNode 2: Middle by Author Middle\n"
+                       "Node 3: Audio (narrated by Narrator)\nNode 4: Last by Author Last\n");
+
+    std::ostringstream grouped;
+    store.printByType(grouped);
+    CHECK(grouped.str().find("--- Print books (2) ---\nTitle: Middle") == 0);
+    CHECK(grouped.str().find("--- Audio books (2) ---\nTitle: First") != std::string::npos);
+
+    CHECK(store.removeAt(1));
+    CHECK(store.deleteByTitle("First"));
+    CHECK_FALSE(store.removeAt(2));
+    CHECK(store.at(0)->getTitle() == "Audio");
+    CHECK(store.at(1)->getTitle() == "Last");
+
+    store.clear();
+    CHECK(store.isEmpty());
+}
+
+TEST_CASE("PartitionedReadingItemStore answers type-specific queries from one partition")
+{
+    PartitionedReadingItemStore store;
+    store.insertBack(AudioBook("Included", 300, 9.0, HARD, "Narrator", PriceInfo(0.0, true)));
+    store.insertBack(PrintBook("Print", 100, 2.0, EASY, "Author", PriceInfo(5.0, true)));
+    store.insertBack(AudioBook("Paid", 200, 6.0, MEDIUM, "Narrator", PriceInfo(20.0, false)));
+    store.insertBack(AudioBook("Also included", 250, 7.0, EASY, "Narrator", PriceInfo(0.0, true)));
+
+    std::vector<const AudioBook *> included = store.select<AudioBook>(
+        [](const AudioBook &book) { return book.getPrice().getIncludedWithSubscription(); });
+
+    REQUIRE(included.size() == 2);
+    CHECK(included[0]->getTitle() == "Included");
+    CHECK(included[1]->getTitle() == "Also included");
+    CHECK(store.select<PrintBook>([](const PrintBook &book) { return book.getPages() > 500; }).empty());
+
+    std::unique_ptr<ReadingItem> copy(new PrintBook("Copied", 50, 1.0, EASY, "Author", PriceInfo()));
+    store.insertCopy(*copy);
+    CHECK(store.at(4)->getTitle() == "Copied");
+    CHECK(store.countOf<PrintBook>() == 2);
+}
+
+TEST_CASE("PartitionedReadingItemStore resolves global positions like a plain vector")
+{
+    std::mt19937 random(22);
+    PartitionedReadingItemStore store;
+    std::vector<std::string> expected;
+    PriceInfo price(1.0, false);
+    for (int i = 0; i < 300; i++)
+    {
+        const std::string title = "Book " + std::to_string(i);
+        const bool audio = random() % 3 == 0;
+        if (random() % 4 == 0)
+        {
+            audio ? store.insertFront(AudioBook(title, 100, 1.0, EASY, "Narrator", price))
+                  : store.insertFront(PrintBook(title, 100, 1.0, EASY, "Author", price));
+            expected.insert(expected.begin(), title);
+        }
+        else
+        {
+            audio ? store.insertBack(AudioBook(title, 100, 1.0, EASY, "Narrator", price))
+                  : store.insertBack(PrintBook(title, 100, 1.0, EASY, "Author", price));
+            expected.push_back(title);
+        }
+    }
+
+    for (int i = 0; i < 100; i++)
+    {
+        const int index = static_cast<int>(random() % expected.size());
+        store.removeAt(index);
+        expected.erase(expected.begin() + index);
+    }
+
+    bool samePositions = store.size() == static_cast<int>(expected.size());
+    for (int i = 0; samePositions && i < store.size(); i++)
+    {
+        samePositions = store.at(i)->getTitle() == expected[i];
+    }
+
+    std::vector<std::string> visited;
+    store.visitInOrder([&visited](const ReadingItem &item) { visited.push_back(item.getTitle()); });
+    CHECK(samePositions);
+    CHECK(visited == expected);
+}
+#endif
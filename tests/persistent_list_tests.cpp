@@ -0,0 +1,127 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "structures/persistent_reading_item_list.h"
+
+static std::shared_ptr<const ReadingItem> makeSharedBook(const std::string &title, int pages = 100)
+{
+    return std::make_shared<PrintBook>(title, pages, 2.0, EASY, "Author", PriceInfo(10.0, false));
+}
+
+static std::vector<const ReadingItem *> itemsOf(const PersistentReadingItemList &version)
+{
+    std::vector<const ReadingItem *> result;
+    for (PersistentReadingItemListIterator it = version.begin(); it.isValid(); it.next())
+    {
+        result.push_back(it.getData());
+    }
+
+    return result;
+}
+
+TEST_CASE("PersistentReadingItemList updates return new versions and leave old ones intact")
+{
+    PersistentReadingItemList empty;
+    PersistentReadingItemList one = empty.pushBack(makeSharedBook("Alpha"));
+    PersistentReadingItemList two = one.pushBack(makeSharedBook("Gamma"));
+    PersistentReadingItemList three = two.insertAt(1, makeSharedBook("Beta"));
+    PersistentReadingItemList removed = three.removeAt(0);
+
+    CHECK(empty.isEmpty());
+    CHECK(one.size() == 1);
+    CHECK(two.size() == 2);
+    REQUIRE(three.size() == 3);
+    CHECK(three.at(0)->getTitle() == "Alpha");
+    CHECK(three.at(1)->getTitle() == "Beta");
+    CHECK(three.at(2)->getTitle() == "Gamma");
+    CHECK(removed.at(0)->getTitle() == "Beta");
+    CHECK(two.at(1)->getTitle() == "Gamma");
+
+    PersistentReadingItemList replaced = three.replaceAt(1, makeSharedBook("Delta"));
+    REQUIRE(replaced.size() == 3);
+    CHECK(replaced.at(1)->getTitle() == "Delta");
+    CHECK(three.at(1)->getTitle() == "Beta");
+    CHECK(replaced.shareAt(2) == three.shareAt(2));
+
+    PersistentReadingItemList copy = three;
+    CHECK(copy.sameVersionAs(three));
+    CHECK_FALSE(copy.sameVersionAs(two));
+
+    CHECK_THROWS_AS(three.at(3), ContainerException);
+    CHECK_THROWS_AS(three.removeAt(-1), ContainerException);
+    CHECK_THROWS_AS(three.replaceAt(3, makeSharedBook("Late")), ContainerException);
+    CHECK_THROWS_AS(three.insertAt(5, makeSharedBook("Late")), ContainerException);
+    CHECK_THROWS_AS(three.pushBack(nullptr), ContainerException);
+
+    std::ostringstream output;
+    removed.traverse(output);
+    CHECK(output.str() == "Node 1: Beta by Author\nNode 2: Gamma by Author\n");
+}
+
+TEST_CASE("PersistentReadingItemList matches a vector model across many retained versions")
+{
+    std::mt19937 random(12);
+    std::vector<std::vector<const ReadingItem *>> models(1);
+    std::vector<PersistentReadingItemList> versions(1);
+
+    for (int step = 0; step < 600; step++)
+    {
+        std::vector<const ReadingItem *> model = models.back();
+        PersistentReadingItemList version = versions.back();
+        if (model.empty() || random() % 3 != 0)
+        {
+            const int index = static_cast<int>(random() % (model.size() + 1));
+            std::shared_ptr<const ReadingItem> item = makeSharedBook("Item " + std::to_string(step), step);
+            model.insert(model.begin() + index, item.get());
+            version = version.insertAt(index, item);
+        }
+        else
+        {
+            const int index = static_cast<int>(random() % model.size());
+            model.erase(model.begin() + index);
+            version = version.removeAt(index);
+        }
+
+        models.push_back(model);
+        versions.push_back(version);
+    }
+
+    for (std::size_t i = 0; i < versions.size(); i += 37)
+    {
+        CHECK(itemsOf(versions[i]) == models[i]);
+    }
+
+    CHECK(itemsOf(versions.back()) == models.back());
+}
+
+TEST_CASE("PersistentReadingItemList diff reports only the items that changed")
+{
+    std::vector<std::shared_ptr<const ReadingItem>> items;
+    for (int i = 0; i < 200; i++)
+    {
+        items.push_back(makeSharedBook("Book " + std::to_string(i), i + 1));
+    }
+
+    PersistentReadingItemList before = PersistentReadingItemList::fromItems(items);
+    std::shared_ptr<const ReadingItem> added = makeSharedBook("New arrival");
+    PersistentReadingItemList after = before.removeAt(57).insertAt(120, added);
+
+    PersistentListDiff changes = PersistentReadingItemList::diff(before, after);
+    REQUIRE(changes.added.size() == 1);
+    REQUIRE(changes.removed.size() == 1);
+    CHECK(changes.added[0] == added);
+    CHECK(changes.removed[0] == items[57]);
+
+    PersistentListDiff none = PersistentReadingItemList::diff(after, after);
+    CHECK(none.added.empty());
+    CHECK(none.removed.empty());
+
+    PersistentListDiff fromEmpty = PersistentReadingItemList::diff(PersistentReadingItemList(), before);
+    CHECK(fromEmpty.added.size() == 200);
+    CHECK(fromEmpty.removed.empty());
+}
+#endif
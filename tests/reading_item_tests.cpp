@@ -1,6 +1,11 @@
 #ifdef _DEBUG
 #include "support/test_headers.h"
 
+#include <iomanip>
+#include <memory>
+#include <thread>
+#include <vector>
+
 TEST_CASE("ReadingItem cannot be instantiated directly (Abstract)")
 {
     ReadingItem *item = nullptr;
@@ -74,6 +79,124 @@ TEST_CASE("operator<< outputs one-line AudioBook summary via base reference")
     CHECK(output.str() == "AudioBook: Project Hail Mary (narrated by Ray Porter) | pages: 496 | hours: 18.0 | difficulty: Medium | cost: Free");
 }
 
+TEST_CASE("appendDisplayName appends to a caller's buffer")
+{
+    PriceInfo price(9.99, false);
+    PrintBook print("Dune", 600, 20.0, HARD, "Frank Herbert", price);
+    AudioBook audio("Project Hail Mary", 496, 18.0, MEDIUM, "Ray Porter", price);
+
+    std::string buffer = "1. ";
+    print.appendDisplayName(buffer);
+    buffer.append(", ");
+    audio.appendDisplayName(buffer);
+
+    CHECK(buffer == "1. Dune by Frank Herbert, Project Hail Mary (narrated by Ray Porter)");
+}
+
+TEST_CASE("writeDisplayName streams the current name without the cache")
+{
+    PriceInfo price(9.99, false);
+    PrintBook print("Dune", 600, 20.0, HARD, "Frank Herbert", price);
+    AudioBook audio("Project Hail Mary", 496, 18.0, MEDIUM, "Ray Porter", price);
+
+    std::ostringstream output;
+    print.writeDisplayName(output);
+    output << ", ";
+    audio.writeDisplayName(output);
+    CHECK(output.str() == "Dune by Frank Herbert, Project Hail Mary (narrated by Ray Porter)");
+
+    // The cache filled here must not leak into later streamed names.
+    CHECK(print.displayName() == "Dune by Frank Herbert");
+    print.setTitle("Dune Messiah");
+    std::ostringstream renamed;
+    print.writeDisplayName(renamed);
+    CHECK(renamed.str() == "Dune Messiah by Frank Herbert");
+}
+
+TEST_CASE("displayName is cached until a field it shows changes")
+{
+    PriceInfo price(9.99, false);
+    PrintBook print("Dune", 600, 20.0, HARD, "Frank Herbert", price);
+    AudioBook audio("Project Hail Mary", 496, 18.0, MEDIUM, "Ray Porter", price);
+
+    const std::string &cached = print.displayName();
+    CHECK(&print.displayName() == &cached);
+
+    print.setPages(700);
+    CHECK(print.displayName() == "Dune by Frank Herbert");
+
+    print.setTitle("Dune Messiah");
+    CHECK(print.displayName() == "Dune Messiah by Frank Herbert");
+
+    print.setAuthor("Author 1");
+    CHECK(print.displayName() == "Dune Messiah by Author 1");
+
+    CHECK(audio.displayName() == "Project Hail Mary (narrated by Ray Porter)");
+    audio.setNarrator("Narrator 1");
+    CHECK(audio.displayName() == "Project Hail Mary (narrated by Narrator 1)");
+
+    PrintBook copy(print);
+    copy.setTitle("Children of Dune");
+    CHECK(copy.displayName() == "Children of Dune by Author 1");
+    CHECK(print.displayName() == "Dune Messiah by Author 1");
+}
+
+TEST_CASE("PriceInfo writeCost matches formattedCost and keeps stream state")
+{
+    const PriceInfo paid(14.5, false);
+    const PriceInfo free(0.0, true);
+
+    std::ostringstream output;
+    output << std::fixed << std::setprecision(1) << 1.25 << " ";
+    paid.writeCost(output);
+    output << " ";
+    free.writeCost(output);
+    output << " " << 2.25;
+
+    CHECK(paid.formattedCost() == "$14.50");
+    CHECK(free.formattedCost() == "Free");
+    CHECK(output.str() == "1.2 $14.50 Free 2.2");
+
+    // %.2f prints all sixty integer digits of 1e60, more than the stack buffer holds.
+    const PriceInfo huge(1e60, false);
+    std::ostringstream expected;
+    expected << "$" << std::fixed << std::setprecision(2) << 1e60;
+    const std::string formatted = huge.formattedCost();
+    CHECK(formatted.size() > 48);
+    CHECK(formatted == expected.str());
+
+    std::ostringstream hugeOutput;
+    huge.writeCost(hugeOutput);
+    CHECK(hugeOutput.str() == formatted);
+}
+
+TEST_CASE("displayName can be filled by concurrent readers")
+{
+    const PrintBook book("Dune", 600, 20.0, HARD, "Frank Herbert", PriceInfo(9.99, false));
+    std::vector<std::thread> readers;
+    std::vector<int> matches(4, 0);
+    for (int reader = 0; reader < 4; reader++)
+    {
+        readers.emplace_back([&book, &matches, reader]()
+                             {
+                                 for (int i = 0; i < 1000; i++)
+                                 {
+                                     matches[reader] += book.displayName() == "Dune by Frank Herbert";
+                                 }
+                             });
+    }
+
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+
+    for (int count : matches)
+    {
+        CHECK(count == 1000);
+    }
+}
+
 TEST_CASE("Function template safeDivide works with int")
 {
     CHECK(safeDivide(12, 3) == 4);
@@ -94,4 +217,93 @@ TEST_CASE("Polymorphism via Base Pointer")
     CHECK(item->displayName() == "Polymorphism by Author");
     delete item;
 }
+
+TEST_CASE("CollationKey folds case once and can skip a leading article")
+{
+    CollationKey key("The Lord of the Rings");
+    CHECK(key.full() == "the lord of the rings");
+    CHECK(key.withoutArticle() == "lord of the rings");
+    CHECK(CollationKey("An  Echo").withoutArticle() == "echo");
+    CHECK(CollationKey("A Tale").withoutArticle() == "tale");
+    CHECK(CollationKey("Theory").withoutArticle() == "theory");
+    CHECK(CollationKey("The ").withoutArticle() == "the ");
+
+    // Latin-1 capitals in UTF-8 fold too; other bytes are left alone.
+    CHECK(foldTitle("\xC3\x89MILE \xC3\x97 Z") == "\xC3\xA9mile \xC3\x97 z");
+
+    PriceInfo price(10.0, false);
+    PrintBook book("Dune", 412, 9.0, HARD, "Frank Herbert", price);
+    CHECK(book.getCollationKey().full() == "dune");
+    book.setTitle("The DUNE Messiah");
+    CHECK(book.getCollationKey().full() == "the dune messiah");
+    CHECK(book.getCollationKey().withoutArticle() == "dune messiah");
+}
+
+TEST_CASE("NamePool stores each distinct name once")
+{
+    NamePool pool;
+    const NamePool::Symbol herbert = pool.intern("Frank Herbert");
+    const NamePool::Symbol porter = pool.intern("Ray Porter");
+
+    CHECK(pool.intern(std::string("Frank ") + "Herbert") == herbert);
+    CHECK(herbert != porter);
+    CHECK(pool.view(herbert) == "Frank Herbert");
+    CHECK(pool.view(porter) == "Ray Porter");
+    CHECK(pool.size() == 2);
+    CHECK(pool.storedBytes() == 23);
+}
+
+TEST_CASE("PrintBook and AudioBook share interned names")
+{
+    PriceInfo price(10.0, false);
+    PrintBook first("Dune", 600, 20.0, HARD, "Frank Herbert", price);
+    PrintBook second("Dune Messiah", 330, 11.0, HARD, "Frank Herbert", price);
+    AudioBook audio("Dune", 600, 21.0, HARD, "Frank Herbert", price);
+
+    CHECK(first.getAuthor().data() == second.getAuthor().data());
+    CHECK(audio.getNarrator().data() == first.getAuthor().data());
+
+    second.setAuthor("Brian Herbert");
+    CHECK(second.getAuthor() == "Brian Herbert");
+    CHECK(first.getAuthor() == "Frank Herbert");
+
+    // A clone keeps the symbol, not a copy of the name.
+    std::unique_ptr<ReadingItem> copy(first.clone());
+    CHECK(static_cast<PrintBook *>(copy.get())->getAuthor().data() == first.getAuthor().data());
+    CHECK(PrintBook().getAuthor() == "Unknown");
+}
+
+TEST_CASE("NamePool hands out one symbol per name across threads")
+{
+    NamePool pool;
+    std::vector<std::vector<NamePool::Symbol>> seen(4);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back(
+            [&pool, &seen, t]()
+            {
+                for (int i = 0; i < 5000; i++)
+                {
+                    seen[t].push_back(pool.intern("Name " + std::to_string((i * (t + 1)) % 5000)));
+                }
+            });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    bool consistent = pool.size() == 5000;
+    for (int t = 0; consistent && t < 4; t++)
+    {
+        for (int i = 0; consistent && i < 5000; i++)
+        {
+            consistent = pool.view(seen[t][i]) == "Name " + std::to_string((i * (t + 1)) % 5000);
+        }
+    }
+
+    CHECK(consistent);
+}
 #endif
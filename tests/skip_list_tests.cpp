@@ -0,0 +1,280 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "structures/reading_item_skip_list.h"
+
+TEST_CASE("ReadingItemSkipList inserts at the front, back, and middle")
+{
+    ReadingItemSkipList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(new PrintBook("Middle", 200, 8.0, MEDIUM, "Author Middle", price));
+    list.insertFront(new PrintBook("First", 120, 4.0, EASY, "Author First", price));
+    list.insertBack(new AudioBook("Last", 180, 7.0, HARD, "Narrator Last", price));
+    list.insertAt(2, new PrintBook("Third", 90, 3.0, EASY, "Author Third", price));
+
+    CHECK(list.size() == 4);
+    CHECK(list.at(0)->getTitle() == "First");
+    CHECK(list.at(1)->getTitle() == "Middle");
+    CHECK(list.at(2)->getTitle() == "Third");
+    CHECK(list.at(3)->getTitle() == "Last");
+    CHECK(list.findByTitle("Third") == 2);
+    CHECK_THROWS_AS(list.at(4), ContainerException);
+}
+
+TEST_CASE("ReadingItemSkipList removeAt and deleteByTitle keep positions consistent")
+{
+    ReadingItemSkipList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(new PrintBook("Book 1", 100, 5.0, EASY, "Author 1", price));
+    list.insertBack(new PrintBook("Book 2", 200, 10.0, MEDIUM, "Author 2", price));
+    list.insertBack(new PrintBook("Book 3", 300, 15.0, HARD, "Author 3", price));
+
+    CHECK(list.removeAt(1) == true);
+    CHECK(list.removeAt(5) == false);
+    CHECK(list.at(1)->getTitle() == "Book 3");
+    CHECK(list.deleteByTitle("Book 1") == true);
+    CHECK(list.deleteByTitle("Book 1") == false);
+    CHECK(list.size() == 1);
+    CHECK(list.at(0)->getTitle() == "Book 3");
+}
+
+TEST_CASE("ReadingItemSkipList iterator and traverse walk the list in order")
+{
+    ReadingItemSkipList list;
+    PriceInfo price(10.0, false);
+    std::ostringstream emptyOutput;
+
+    list.traverse(emptyOutput);
+    CHECK(emptyOutput.str() == "List is empty.\n");
+
+    list.insertBack(new PrintBook("First", 100, 5.0, EASY, "Author 1", price));
+    list.insertBack(new PrintBook("Second", 200, 10.0, MEDIUM, "Author 2", price));
+
+    ReadingItemSkipListIterator iterator = list.begin();
+    CHECK(iterator.getData()->getTitle() == "First");
+    iterator.next();
+    CHECK(iterator.getData()->getTitle() == "Second");
+    iterator.next();
+    CHECK(iterator.isValid() == false);
+    CHECK_THROWS_AS(iterator.getData(), ContainerException);
+}
+
+TEST_CASE("ReadingItemSkipList matches a vector model under random positional edits")
+{
+    ReadingItemSkipList list;
+    std::vector<ReadingItem *> model;
+    std::mt19937 random(7);
+    PriceInfo price(10.0, false);
+
+    for (int step = 0; step < 2000; step++)
+    {
+        int size = static_cast<int>(model.size());
+        if (size == 0 || random() % 3 != 0)
+        {
+            int index = static_cast<int>(random() % (size + 1));
+            ReadingItem *item = new PrintBook("Item " + std::to_string(step), 10, 1.0, EASY, "A", price);
+            list.insertAt(index, item);
+            model.insert(model.begin() + index, item);
+        }
+        else
+        {
+            int index = static_cast<int>(random() % size);
+            list.removeAt(index);
+            model.erase(model.begin() + index);
+        }
+    }
+
+    REQUIRE(list.size() == static_cast<int>(model.size()));
+    bool allMatch = true;
+    for (int i = 0; i < list.size(); i++)
+    {
+        allMatch = allMatch && list.at(i) == model[i];
+    }
+
+    CHECK(allMatch);
+}
+
+TEST_CASE("IndexableSkipList finds each node's rank and erases by node")
+{
+    IndexableSkipList<int> list;
+    std::vector<IndexableSkipListNode<int> *> model;
+    std::mt19937 random(4);
+
+    for (int step = 0; step < 2000; step++)
+    {
+        const int size = static_cast<int>(model.size());
+        if (size == 0 || random() % 3 != 0)
+        {
+            const int index = static_cast<int>(random() % (size + 1));
+            model.insert(model.begin() + index, list.insertAt(index, step));
+        }
+        else
+        {
+            const int index = static_cast<int>(random() % size);
+            const int value = model[index]->data;
+            CHECK(list.erase(model[index]) == value);
+            model.erase(model.begin() + index);
+        }
+    }
+
+    REQUIRE(list.size() == static_cast<int>(model.size()));
+    bool ranksMatch = true;
+    for (int i = 0; i < list.size(); i++)
+    {
+        ranksMatch = ranksMatch && list.rankOf(model[i]) == i && list.nodeAt(i) == model[i];
+    }
+
+    CHECK(ranksMatch);
+    CHECK(list.nodeAt(list.size()) == nullptr);
+    CHECK_THROWS_AS(list.removeAt(-1), ContainerException);
+}
+
+TEST_CASE("ReadingItemList with a position index matches a vector model")
+{
+    ReadingItemList list;
+    list.setPositionIndex(true);
+    std::vector<ReadingItem *> model;
+    std::mt19937 random(9);
+    PriceInfo price(10.0, false);
+
+    for (int step = 0; step < 1500; step++)
+    {
+        const int size = static_cast<int>(model.size());
+        const int action = size == 0 ? 0 : static_cast<int>(random() % 8);
+        if (action < 3)
+        {
+            ReadingItem *item = new PrintBook("Item " + std::to_string(random() % 500), 10, 1.0, EASY, "A", price);
+            list.insertBack(item);
+            model.push_back(item);
+        }
+        else if (action == 3)
+        {
+            ReadingItem *item = new PrintBook("Item " + std::to_string(random() % 500), 10, 1.0, EASY, "A", price);
+            list.insertFront(item);
+            model.insert(model.begin(), item);
+        }
+        else if (action == 4)
+        {
+            const int index = static_cast<int>(random() % size);
+            list.removeAt(index);
+            model.erase(model.begin() + index);
+        }
+        else if (action == 5)
+        {
+            const int index = static_cast<int>(random() % size);
+            CHECK(list.findByTitle(model[index]->getTitle()) <= index);
+        }
+        else if (action == 6)
+        {
+            if (step % 100 < 10)
+            {
+                list.sortByTitle();
+                std::stable_sort(model.begin(), model.end(), [](const ReadingItem *left, const ReadingItem *right)
+                                 { return left->getCollationKey().full() < right->getCollationKey().full(); });
+            }
+        }
+        else
+        {
+            const int index = static_cast<int>(random() % size);
+            ReadingItem *taken = list.at(index);
+            CHECK(list.extract(taken));
+            model.erase(model.begin() + index);
+            delete taken;
+        }
+    }
+
+    REQUIRE(list.size() == static_cast<int>(model.size()));
+    REQUIRE_FALSE(model.empty());
+    bool allMatch = true;
+    for (int i = 0; i < list.size(); i++)
+    {
+        allMatch = allMatch && list.at(i) == model[i] && list.handleAt(i)->data == model[i];
+    }
+
+    CHECK(allMatch);
+    const std::string &lastTitle = model.back()->getTitle();
+    const auto firstWithLastTitle = std::find_if(model.begin(), model.end(), [&lastTitle](const ReadingItem *item)
+                                                 { return item->getTitle() == lastTitle; });
+    CHECK(list.findByTitle(lastTitle) == static_cast<int>(firstWithLastTitle - model.begin()));
+
+    list.setPositionIndex(false);
+    CHECK_FALSE(list.hasPositionIndex());
+    CHECK(list.at(0) == model[0]);
+}
+
+TEST_CASE("ReadingItemList insertAt places items by index and keeps duplicate titles in list order")
+{
+    for (bool indexed : {true, false})
+    {
+        ReadingItemList list;
+        list.setPositionIndex(indexed);
+        std::vector<ReadingItem *> model;
+        std::mt19937 random(12);
+        PriceInfo price(10.0, false);
+
+        for (int step = 0; step < 800; step++)
+        {
+            const int size = static_cast<int>(model.size());
+            if (size > 0 && random() % 4 == 0)
+            {
+                const int index = static_cast<int>(random() % size);
+                list.removeAt(index);
+                model.erase(model.begin() + index);
+                continue;
+            }
+
+            const int index = static_cast<int>(random() % (size + 1));
+            ReadingItem *item = new PrintBook("Item " + std::to_string(random() % 20), 10, 1.0, EASY, "A", price);
+            list.insertAt(index, item);
+            model.insert(model.begin() + index, item);
+        }
+
+        REQUIRE(list.size() == static_cast<int>(model.size()));
+        bool allMatch = true;
+        for (int i = 0; i < list.size(); i++)
+        {
+            allMatch = allMatch && list.at(i) == model[i];
+        }
+
+        CHECK(allMatch);
+
+        // The hash index chains equal titles in list order, so the earliest one wins.
+        bool earliestFound = true;
+        for (int title = 0; title < 20; title++)
+        {
+            const std::string name = "Item " + std::to_string(title);
+            const auto first = std::find_if(model.begin(), model.end(),
+                                            [&name](const ReadingItem *item) { return item->getTitle() == name; });
+            const int expected = first == model.end() ? -1 : static_cast<int>(first - model.begin());
+            earliestFound = earliestFound && list.findByTitle(name) == expected;
+        }
+
+        CHECK(earliestFound);
+
+        PrintBook outsider("Outsider", 10, 1.0, EASY, "A", price);
+        CHECK_THROWS_AS(list.insertAt(-1, &outsider), ContainerException);
+        CHECK_THROWS_AS(list.insertAt(list.size() + 1, &outsider), ContainerException);
+        CHECK(list.size() == static_cast<int>(model.size()));
+        CHECK(outsider.getObserver(CONTAINER_OBSERVER) == nullptr);
+    }
+}
+
+TEST_CASE("ReadingItemList insertAt keeps title order in a TITLE_ORDER list")
+{
+    ReadingItemList list(ALLOW_DUPLICATE_TITLES, TITLE_ORDER);
+    PriceInfo price(10.0, false);
+    list.insertAt(0, new PrintBook("Walden", 10, 1.0, EASY, "A", price));
+    list.insertAt(0, new PrintBook("Emma", 10, 1.0, EASY, "A", price));
+    list.insertAt(2, new PrintBook("Beloved", 10, 1.0, EASY, "A", price));
+
+    CHECK(list.at(0)->getTitle() == "Beloved");
+    CHECK(list.at(1)->getTitle() == "Emma");
+    CHECK(list.at(2)->getTitle() == "Walden");
+}
+#endif
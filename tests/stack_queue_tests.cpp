@@ -66,6 +66,24 @@ TEST_CASE("Queue enqueue front dequeue FIFO order")
     CHECK(q.isEmpty() == true);
 }
 
+TEST_CASE("Queue enqueueAll appends a batch after existing titles in order")
+{
+    Queue q;
+    q.enqueue("first");
+    q.enqueueAll({"second", "third"});
+    q.enqueueAll({});
+    CHECK(q.front() == "first");
+    q.dequeue();
+    CHECK(q.front() == "second");
+    q.dequeue();
+    CHECK(q.front() == "third");
+    q.dequeue();
+    CHECK(q.isEmpty());
+
+    q.enqueueAll({"fourth"});
+    CHECK(q.front() == "fourth");
+}
+
 TEST_CASE("Queue dequeue on empty throws")
 {
     Queue q;
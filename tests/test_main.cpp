@@ -15,6 +15,13 @@ static bool runCrtManagerLeakCheck()
     _CrtMemState endState;
     _CrtMemState diffState;
 
+    // Names stay in the pool for the life of the program, so intern them before
+    // the checkpoint rather than count them as leaks.
+    for (const char *name : {"Author 1", "Author 2", "Narrator 1"})
+    {
+        NamePool::global().intern(name);
+    }
+
     _CrtMemCheckpoint(&startState);
     {
         Manager manager;
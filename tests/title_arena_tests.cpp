@@ -0,0 +1,104 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "structures/title_arena.h"
+
+TEST_CASE("TitleArena copies strings into stable chunks")
+{
+    TitleArena arena;
+    std::string source = "the hobbit";
+    const std::string_view stored = arena.store(source);
+    source = "changed";
+
+    CHECK(stored == "the hobbit");
+    CHECK(arena.store("").empty());
+    CHECK(arena.getLiveBytes() == 10);
+    CHECK(arena.chunkCount() == 1);
+
+    // Filling past a chunk opens another one without moving earlier strings.
+    std::vector<std::string_view> views;
+    for (int i = 0; i < 20000; i++)
+    {
+        views.push_back(arena.store("title number " + std::to_string(i)));
+    }
+
+    CHECK(arena.chunkCount() > 1);
+    CHECK(stored == "the hobbit");
+    CHECK(views[0] == "title number 0");
+    CHECK(views[19999] == "title number 19999");
+
+    const std::string huge(200000, 'x');
+    CHECK(arena.store(huge) == huge);
+}
+
+TEST_CASE("TitleArena counts released bytes and adopts another arena's chunks")
+{
+    TitleArena arena;
+    TitleArena other;
+    const std::string_view kept = arena.store("kept title");
+    const std::string_view adopted = other.store("adopted title");
+
+    arena.adopt(other);
+    CHECK(kept == "kept title");
+    CHECK(adopted == "adopted title");
+    CHECK(arena.getLiveBytes() == 23);
+    CHECK(other.chunkCount() == 0);
+    CHECK(other.getLiveBytes() == 0);
+
+    arena.release(adopted);
+    CHECK(arena.getLiveBytes() == 10);
+    CHECK(arena.getDeadBytes() == 13);
+    CHECK_FALSE(arena.shouldCompact());
+
+    std::vector<std::string_view> churn;
+    const std::string longTitle(100, 'a');
+    for (int i = 0; i < 2000; i++)
+    {
+        churn.push_back(arena.store(longTitle));
+    }
+
+    for (std::string_view view : churn)
+    {
+        arena.release(view);
+    }
+
+    CHECK(arena.shouldCompact());
+    arena.clear();
+    CHECK(arena.chunkCount() == 0);
+    CHECK(arena.getDeadBytes() == 0);
+}
+
+TEST_CASE("ReadingItemList title lookups survive heavy churn of arena-backed keys")
+{
+    ReadingItemList list;
+    PriceInfo price(10.0, false);
+    const std::string padding(80, '.');
+    for (int round = 0; round < 20; round++)
+    {
+        for (int i = 0; i < 200; i++)
+        {
+            list.insertBack(new PrintBook("Churn " + std::to_string(round) + "-" + std::to_string(i) + padding, 100,
+                                          1.0, EASY, "Author", price));
+        }
+
+        // Keep only the last round's items, so most stored keys become dead.
+        while (list.size() > 200)
+        {
+            list.removeAt(0);
+        }
+    }
+
+    list.insertBack(new PrintBook("Zebra", 100, 1.0, EASY, "Author", price));
+    CHECK(list.size() == 201);
+    CHECK(list.binarySearchByTitle("zebra") == 200);
+    CHECK(list.searchByTitlePrefix(std::string_view("CHURN 19-1")).size() == 111);
+    CHECK(list.findByTitle("Churn 19-0" + padding) == 0);
+    CHECK(list.searchByTitle("Churn 18-0" + padding) == nullptr);
+    CHECK(list.deleteByTitle(std::string_view("Zebra")));
+    CHECK(list.binarySearchByTitle("Zebra") == -1);
+}
+#endif
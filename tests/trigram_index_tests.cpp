@@ -0,0 +1,146 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "structures/trigram_title_index.h"
+
+static std::vector<std::string> titlesOf(const std::vector<ReadingItem *> &items)
+{
+    std::vector<std::string> titles;
+    for (const ReadingItem *item : items)
+    {
+        titles.push_back(item->getTitle());
+    }
+
+    return titles;
+}
+
+TEST_CASE("TrigramTitleIndex finds substrings anywhere in a title, ignoring case")
+{
+    PriceInfo price(10.0, false);
+    PrintBook habits("Atomic Habits", 320, 5.0, EASY, "James Clear", price);
+    PrintBook work("Deep Work", 280, 6.0, MEDIUM, "Cal Newport", price);
+    AudioBook learning("Deep Learning", 700, 20.0, HARD, "Narrator", price);
+    PrintBook tricky("bcdabc", 10, 1.0, EASY, "Author", price);
+
+    TrigramTitleIndex index;
+    index.insert(&habits);
+    index.insert(&work);
+    index.insert(&learning);
+    index.insert(&tricky);
+    CHECK(index.size() == 4);
+
+    std::vector<std::string> deepTitles = titlesOf(index.search("DEEP"));
+    std::sort(deepTitles.begin(), deepTitles.end());
+    CHECK(deepTitles == std::vector<std::string>{"Deep Learning", "Deep Work"});
+    CHECK(titlesOf(index.search("habit")) == std::vector<std::string>{"Atomic Habits"});
+    CHECK(titlesOf(index.search("p wo")) == std::vector<std::string>{"Deep Work"});
+    CHECK(index.search("missing").empty());
+
+    // Shares every trigram of "abcd" but does not contain it.
+    CHECK(index.search("abcd").empty());
+    CHECK(titlesOf(index.search("dab")) == std::vector<std::string>{"bcdabc"});
+
+    CHECK_FALSE(TrigramTitleIndex::isSearchable("de"));
+    CHECK_THROWS_AS(index.search("de"), ContainerException);
+    CHECK_THROWS_AS(index.insert(nullptr), ContainerException);
+
+    index.remove(&work);
+    CHECK(index.size() == 3);
+    CHECK(titlesOf(index.search("deep")) == std::vector<std::string>{"Deep Learning"});
+
+    // Renamed after indexing: removal still finds every posting.
+    learning.setTitle("Shallow");
+    index.remove(&learning);
+    CHECK(index.size() == 2);
+    CHECK(index.search("deep").empty());
+
+    index.clear();
+    CHECK(index.size() == 0);
+    CHECK(index.search("habit").empty());
+}
+
+TEST_CASE("TrigramTitleIndex removes an item by the key it was indexed under")
+{
+    PriceInfo price(10.0, false);
+    PrintBook first("abcdef", 10, 1.0, EASY, "Author", price);
+    PrintBook second("abcxyz", 10, 1.0, EASY, "Author", price);
+
+    TrigramTitleIndex index;
+    index.insert(&first);
+    CHECK_THROWS_AS(index.insert(&first), ContainerException);
+
+    // The new title shares "abc" with the old one, which is still filed under
+    // "bcd", "cde" and "def" until the item is removed.
+    first.setTitle("abcxyz");
+    CHECK(index.search("bcd").size() == 1);
+    index.remove(&first);
+    CHECK(index.size() == 0);
+    CHECK(index.search("bcd").empty());
+    CHECK(index.search("abc").empty());
+
+    index.insertBatch({&first, &second});
+    CHECK(index.size() == 2);
+    CHECK(index.search("bcx").size() == 2);
+    CHECK_THROWS_AS(index.insertBatch({&second}), ContainerException);
+    CHECK(index.size() == 2);
+}
+
+TEST_CASE("TrigramTitleIndex matches a linear scan across random inserts and removals")
+{
+    std::mt19937 random(15);
+    const std::vector<std::string> words = {"deep", "work", "atomic", "habits", "the", "art", "of", "war", "learning"};
+    std::vector<std::unique_ptr<PrintBook>> books;
+    std::vector<PrintBook *> live;
+    TrigramTitleIndex index;
+
+    for (int step = 0; step < 400; step++)
+    {
+        if (live.empty() || random() % 4 != 0)
+        {
+            std::string title = words[random() % words.size()] + " " + words[random() % words.size()];
+            books.push_back(std::make_unique<PrintBook>(title, 100, 2.0, EASY, "Author", PriceInfo(1.0, false)));
+            live.push_back(books.back().get());
+            index.insert(live.back());
+        }
+        else
+        {
+            const std::size_t victim = random() % live.size();
+            index.remove(live[victim]);
+            live.erase(live.begin() + victim);
+        }
+
+        if (step % 40 == 0)
+        {
+            for (const std::string &query : {std::string("ep w"), std::string("ar"), std::string("habits the"),
+                                             std::string("LEARN")})
+            {
+                if (!TrigramTitleIndex::isSearchable(query))
+                {
+                    continue;
+                }
+
+                std::vector<ReadingItem *> expected;
+                for (PrintBook *book : live)
+                {
+                    if (book->getCollationKey().full().find(foldTitle(query)) != std::string::npos)
+                    {
+                        expected.push_back(book);
+                    }
+                }
+
+                std::vector<ReadingItem *> found = index.search(query);
+                std::sort(expected.begin(), expected.end());
+                std::sort(found.begin(), found.end());
+                CHECK(found == expected);
+            }
+        }
+    }
+
+    CHECK(index.size() == static_cast<int>(live.size()));
+}
+#endif
@@ -0,0 +1,128 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include "structures/unrolled_reading_item_list.h"
+
+TEST_CASE("UnrolledReadingItemList supports inserts at the front and back")
+{
+    UnrolledReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(new PrintBook("Middle", 200, 8.0, MEDIUM, "Author Middle", price));
+    list.insertFront(new PrintBook("First", 120, 4.0, EASY, "Author First", price));
+    list.insertBack(new AudioBook("Last", 180, 7.0, HARD, "Narrator Last", price));
+
+    CHECK(list.size() == 3);
+    CHECK(list.blockCount() == 1);
+    CHECK(list.at(0)->getTitle() == "First");
+    CHECK(list.at(1)->getTitle() == "Middle");
+    CHECK(list.at(2)->getTitle() == "Last");
+    CHECK_THROWS_AS(list.at(3), ContainerException);
+}
+
+TEST_CASE("UnrolledReadingItemList packs many items into few blocks")
+{
+    UnrolledReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        list.insertBack(new PrintBook("Book " + std::to_string(i), 100, 1.0, EASY, "Author", price));
+    }
+
+    CHECK(list.size() == 1000);
+    CHECK(list.blockCount() == (1000 + UnrolledBlock::CAPACITY - 1) / UnrolledBlock::CAPACITY);
+    CHECK(list.at(0)->getTitle() == "Book 0");
+    CHECK(list.at(517)->getTitle() == "Book 517");
+    CHECK(list.findByTitle("Book 999") == 999);
+
+    int visited = 0;
+    for (UnrolledReadingItemListIterator it = list.begin(); it.isValid(); it.next())
+    {
+        visited++;
+    }
+
+    CHECK(visited == 1000);
+}
+
+TEST_CASE("UnrolledReadingItemList removals shift items and release empty blocks")
+{
+    UnrolledReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    for (int i = 0; i < 100; i++)
+    {
+        list.insertBack(new PrintBook("Book " + std::to_string(i), 100, 1.0, EASY, "Author", price));
+    }
+
+    CHECK(list.removeAt(40) == true);
+    CHECK(list.at(40)->getTitle() == "Book 41");
+    CHECK(list.deleteByTitle("Book 0") == true);
+    CHECK(list.deleteByTitle("Book 0") == false);
+    CHECK(list.removeAt(500) == false);
+
+    while (list.size() > 1)
+    {
+        list.removeAt(0);
+    }
+
+    CHECK(list.blockCount() == 1);
+    CHECK(list.at(0)->getTitle() == "Book 99");
+    CHECK(list.searchByTitle("Book 99") == list.at(0));
+
+    list.removeAt(0);
+    CHECK(list.isEmpty() == true);
+    CHECK(list.blockCount() == 0);
+
+    list.insertFront(new PrintBook("Again", 100, 1.0, EASY, "Author", price));
+    CHECK(list.at(0)->getTitle() == "Again");
+}
+
+TEST_CASE("UnrolledReadingItemList keeps blocks at least half full as items are removed")
+{
+    UnrolledReadingItemList list;
+    PriceInfo price(10.0, false);
+    const int blockCount = 100;
+    for (int i = 0; i < blockCount * UnrolledBlock::CAPACITY; i++)
+    {
+        list.insertBack(new PrintBook("Book " + std::to_string(i), 100, 1.0, EASY, "Author", price));
+    }
+
+    REQUIRE(list.blockCount() == blockCount);
+
+    // Take all but one item out of each original block, front block first.
+    for (int block = 0; block < blockCount; block++)
+    {
+        for (int removal = 0; removal < UnrolledBlock::CAPACITY - 1; removal++)
+        {
+            list.removeAt(block);
+        }
+    }
+
+    REQUIRE(list.size() == blockCount);
+    CHECK(list.blockCount() <= (list.size() + UnrolledBlock::HALF - 1) / UnrolledBlock::HALF);
+    for (int i = 0; i < blockCount; i++)
+    {
+        CHECK(list.at(i)->getTitle() == "Book " + std::to_string(i * UnrolledBlock::CAPACITY + UnrolledBlock::CAPACITY - 1));
+    }
+
+    // Removing from the tail borrows from or merges into the previous block.
+    while (list.size() > UnrolledBlock::HALF)
+    {
+        list.removeAt(list.size() - 1);
+        CHECK(list.blockCount() <= (list.size() + UnrolledBlock::HALF - 1) / UnrolledBlock::HALF);
+    }
+
+    CHECK(list.blockCount() == 1);
+}
+
+TEST_CASE("UnrolledReadingItemList traverse reports an empty list")
+{
+    UnrolledReadingItemList list;
+    std::ostringstream output;
+
+    list.traverse(output);
+
+    CHECK(output.str() == "List is empty.\n");
+}
+#endif
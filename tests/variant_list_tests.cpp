@@ -0,0 +1,134 @@
+#ifdef _DEBUG
+#include "support/test_headers.h"
+
+#include <memory>
+#include <sstream>
+#include <type_traits>
+
+#include "structures/variant_reading_item_list.h"
+
+TEST_CASE("VariantReadingItemList stores books by value at the front and back")
+{
+    VariantReadingItemList list;
+    PriceInfo price(10.0, false);
+
+    list.insertBack(PrintBook("Middle", 200, 8.0, MEDIUM, "Author Middle", price));
+    list.insertFront(PrintBook("First", 120, 4.0, EASY, "Author First", price));
+    ReadingItem &last = list.emplaceBack<AudioBook>("Last", 180, 7.0, HARD, "Narrator Last", price);
+
+    CHECK(list.size() == 3);
+    CHECK(list.chunkCount() == 1);
+    CHECK(list.at(0)->getTitle() == "First");
+    CHECK(list.at(1)->getTitle() == "Middle");
+    CHECK(list.at(2) == &last);
+    CHECK(last.displayName() == "Last (narrated by Narrator Last)");
+    CHECK_THROWS_AS(list.at(3), ContainerException);
+    CHECK(list.getTotalPages() == 500);
+    CHECK(list.getTotalHours() == doctest::Approx(19.0));
+
+    std::ostringstream out;
+    list.traverse(out);
+    CHECK(out.str() == "Node 1: First by Author First\nNode 2: Middle by Author Middle\n"
+                       "Node 3: Last (narrated by Narrator Last)\n");
+}
+
+TEST_CASE("VariantReadingItemList visits each value as its concrete type")
+{
+    VariantReadingItemList list;
+    PriceInfo price(10.0, false);
+    list.emplaceBack<PrintBook>("Print", 100, 2.0, EASY, "Author", price);
+    list.emplaceBack<AudioBook>("Audio", 300, 9.0, HARD, "Narrator", price);
+    list.emplaceBack<PrintBook>("Print 2", 150, 3.0, MEDIUM, "Author", price);
+
+    int printBooks = 0;
+    std::string narrators;
+    list.visit(
+        [&](auto &book)
+        {
+            using Book = std::decay_t<decltype(book)>;
+            if constexpr (std::is_same_v<Book, PrintBook>)
+            {
+                printBooks++;
+                book.setAuthor("Edited");
+            }
+            else
+            {
+                narrators += book.getNarrator();
+            }
+        });
+
+    CHECK(printBooks == 2);
+    CHECK(narrators == "Narrator");
+    CHECK(static_cast<PrintBook *>(list.at(2))->getAuthor() == "Edited");
+}
+
+TEST_CASE("VariantReadingItemList fills chunks, keeps appended values in place and compacts on removal")
+{
+    VariantReadingItemList list;
+    PriceInfo price(10.0, false);
+    ReadingItem &first = list.emplaceBack<PrintBook>("Book 0", 100, 1.0, EASY, "Author", price);
+    for (int i = 1; i < 200; i++)
+    {
+        list.insertBack(PrintBook("Book " + std::to_string(i), 100 + i, 1.0, EASY, "Author", price));
+    }
+
+    CHECK(list.size() == 200);
+    CHECK(list.chunkCount() == (200 + VariantReadingItemList::CHUNK_CAPACITY - 1) / VariantReadingItemList::CHUNK_CAPACITY);
+    CHECK(list.at(0) == &first);
+    CHECK(list.findByTitle("Book 150") == 150);
+    CHECK(list.searchByTitle("Book 77")->getPages() == 177);
+    CHECK(list.searchByTitle("Missing") == nullptr);
+
+    // Chunks hold 64, 64, 64 and 8 values; once the third is down to 56 the
+    // last one fits into it and the two merge.
+    bool removedAll = true;
+    for (int i = 0; i < 8; i++)
+    {
+        removedAll = list.removeAt(128) && removedAll;
+    }
+
+    CHECK(removedAll);
+    CHECK(list.size() == 192);
+    CHECK(list.chunkCount() == 3);
+    CHECK(list.at(128)->getTitle() == "Book 136");
+    CHECK(list.at(191)->getTitle() == "Book 199");
+    CHECK(list.at(0) == &first);
+
+    // Emptying a chunk drops it.
+    for (int i = 0; i < VariantReadingItemList::CHUNK_CAPACITY; i++)
+    {
+        removedAll = list.removeAt(0) && removedAll;
+    }
+
+    CHECK(removedAll);
+    CHECK(list.chunkCount() == 2);
+    CHECK(list.at(0)->getTitle() == "Book 64");
+    CHECK(list.deleteByTitle("Book 64"));
+    CHECK_FALSE(list.deleteByTitle("Book 64"));
+    CHECK_FALSE(list.removeAt(-1));
+    CHECK_FALSE(list.removeAt(list.size()));
+
+    list.clear();
+    CHECK(list.isEmpty());
+    CHECK(list.chunkCount() == 0);
+    std::ostringstream out;
+    list.traverse(out);
+    CHECK(out.str() == "List is empty.\n");
+}
+
+TEST_CASE("VariantReadingItemList copies polymorphic items by their concrete type")
+{
+    PriceInfo price(12.0, true);
+    std::unique_ptr<ReadingItem> print(new PrintBook("Dune", 600, 20.0, HARD, "Frank Herbert", price));
+    std::unique_ptr<ReadingItem> audio(new AudioBook("Dune", 600, 21.0, HARD, "Scott Brick", price));
+
+    VariantReadingItemList list;
+    list.insertCopy(*print);
+    list.insertCopy(*audio);
+
+    CHECK(list.at(0) != print.get());
+    CHECK(list.at(0)->displayName() == print->displayName());
+    CHECK(list.at(1)->displayName() == audio->displayName());
+    CHECK(list.at(1)->getPrice().getIncludedWithSubscription());
+}
+#endif